@@ -1,14 +1,25 @@
 #include <ESP8266WiFi.h>
 #include <DNSServer.h>
-#include <ESP8266WebServer.h>
+#include <ESPAsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <WiFiUdp.h>
+#include <LittleFS.h>
 #include <Adafruit_NeoPixel.h>
 #include <math.h>
+#include "index_html_gz.h" // Generated by tools/embed_html.py
 
 // ========== STABILITY IMPROVEMENTS ==========
 #include <Ticker.h>
 
 // Forward declarations
 void testSequence();
+bool detectOnset(const uint8_t *bands, unsigned long now);
+void readCurrentState(int32_t *state);
+bool touchGestureUsed(uint8_t gesture);
+void runTouchGesture(uint8_t gesture, unsigned long dueMicros);
+void touchHoldStart(unsigned long dueMicros);
+void touchHoldUpdate();
+void touchHoldEnd();
 void ICACHE_RAM_ATTR resetWatchdog();
 
 // Watchdog timer to prevent resets
@@ -38,16 +49,12 @@ uint8_t cos8(uint8_t theta) {
 // ========== TOUCH SENSOR CONFIGURATION ==========
 // Add touch sensor pin configuration
 #define TOUCH_SENSOR_PIN 2      // D4 on NodeMCU (GPIO2) - CHANGED FROM 4 TO 2
-#define TOUCH_DEBOUNCE_TIME 300 // ms debounce time
-#define LONG_PRESS_TIME 1500    // ms for long press
-
-// Touch sensor variables
-bool lastTouchState = false;
-bool currentTouchState = false;
-unsigned long lastTouchTime = 0;
-unsigned long touchStartTime = 0;
-bool touchActive = false;
-bool longPressDetected = false;
+#define TOUCH_DEBOUNCE_TIME 20  // ms after an edge in which further edges are bounce
+#define TOUCH_MIN_PRESS 40      // ms - shorter presses are noise
+#define TOUCH_TAP_WINDOW 250    // ms after a tap in which the next one adds to it
+#define TOUCH_HOLD_TIME 500     // ms before a press counts as a hold
+#define TOUCH_QUEUE_SIZE 16     // Edges buffered for loop(), power of two
+#define TOUCH_FEEDBACK_BLINK 50 // ms per feedback blink phase
 
 // Touch control mode
 bool touchMode = false;         // True when controlling via touch
@@ -67,12 +74,97 @@ IPAddress apIP(192, 168, 4, 1);
 IPAddress gateway(192, 168, 4, 1);
 IPAddress subnet(255, 255, 255, 0);
 
+// Which network the lamp is on - see STATION MODE
+enum WifiState : uint8_t {
+  WIFI_STATE_AP,          // Own access point (no home network configured or join failed)
+  WIFI_STATE_CONNECTING,  // Joining the home network
+  WIFI_STATE_STATION      // Joined the home network
+};
+volatile uint8_t wifiState = WIFI_STATE_AP;
+
+// Phones on our own access point, counted by the soft-AP events so the
+// render loop never has to ask the SDK
+volatile uint8_t apStationCount = 0;
+WiFiEventHandler apStationConnectedHandler;
+WiFiEventHandler apStationDisconnectedHandler;
+
+// Address phones and other lamps reach us on - the access point's while
+// the station has no address (also in the AP+STA fallback, which stays
+// in WIFI_STATE_CONNECTING)
+IPAddress lampIP() {
+  IPAddress stationIP = WiFi.localIP();
+  return (wifiState != WIFI_STATE_AP && stationIP.isSet()) ? stationIP : WiFi.softAPIP();
+}
+
 // Create server objects
 DNSServer dnsServer;
-ESP8266WebServer webServer(80);
+AsyncWebServer webServer(80);
+AsyncWebSocket ws("/ws");
+
+// Crossfade from a snapshot of the LEDs into whatever is drawn next (the
+// playlist uses it between entries). Effects read their pixels back to
+// fade them, so the mix only goes out to the LEDs and the buffer is put
+// back after every show().
+uint8_t transitionFrom[NUM_LEDS * 3];
+unsigned long transitionStart = 0;
+uint16_t transitionMillis = 0;   // 0 = no crossfade running
+
+// Scheduler ramps scale the output by a 16-bit level. Each channel keeps
+// what rounding to 8 bits left over and adds it to its next frame, so a
+// slow ramp moves in fractions of a step instead of visible jumps.
+uint16_t outputLevel = 65535;    // 65535 = as drawn
+uint8_t outputResidue[NUM_LEDS * 3];
+
+// Touch feedback blinks drawn over everything: white, off, white, ...
+unsigned long feedbackStart = 0;
+uint8_t feedbackBlinks = 0;      // 0 = none
+uint8_t feedbackLevel = 0;       // White at the brightness of the moment
+
+class LampStrip : public Adafruit_NeoPixel {
+ public:
+  LampStrip(uint16_t n, int16_t pin, neoPixelType type) : Adafruit_NeoPixel(n, pin, type) {}
+  
+  void show() {
+    unsigned long elapsed = millis() - transitionStart;
+    if (transitionMillis && elapsed >= transitionMillis) transitionMillis = 0;
+    if (transitionMillis == 0 && outputLevel == 65535 && feedbackBlinks == 0) {
+      Adafruit_NeoPixel::show();
+      return;
+    }
+    uint8_t *pixels = getPixels();
+    uint8_t drawn[sizeof(transitionFrom)];
+    memcpy(drawn, pixels, sizeof(drawn));
+    if (transitionMillis) {
+      uint16_t mix = elapsed * 256 / transitionMillis;
+      for (uint8_t i = 0; i < sizeof(drawn); i++) {
+        pixels[i] = transitionFrom[i] + (((int)drawn[i] - transitionFrom[i]) * mix >> 8);
+      }
+    }
+    if (outputLevel != 65535) {
+      for (uint8_t i = 0; i < sizeof(drawn); i++) {
+        // In 1/256ths of a step: at most 255 * 255 + 255, so never over 255
+        uint16_t value = (uint32_t)pixels[i] * outputLevel / 257 + outputResidue[i];
+        pixels[i] = value >> 8;
+        outputResidue[i] = value & 0xFF;
+      }
+    }
+    if (feedbackBlinks) {
+      unsigned long phase = (millis() - feedbackStart) / TOUCH_FEEDBACK_BLINK;
+      if (phase < feedbackBlinks * 2UL - 1) memset(pixels, (phase & 1) ? 0 : feedbackLevel, sizeof(drawn));
+    }
+    Adafruit_NeoPixel::show();
+    memcpy(pixels, drawn, sizeof(drawn));
+  }
+};
 
 // Initialize NeoPixel strip
-Adafruit_NeoPixel strip = Adafruit_NeoPixel(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
+LampStrip strip = LampStrip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+void startTransition(uint16_t durationMillis) {
+  memcpy(transitionFrom, strip.getPixels(), sizeof(transitionFrom));
+  transitionStart = millis();
+  transitionMillis = durationMillis;
+}
 
 // ========== MUSIC CONTROL VARIABLES ==========
 // Music control parameters
@@ -82,7 +174,7 @@ int effectSpeed = 50;
 int glowingSpeed = 50;
 bool musicPlaying = false;
 int currentMusicEffect = 0;
-String currentSongName = "No song selected";
+char currentSongName[64] = "No song selected";
 
 // Music effect states
 unsigned long lastMusicUpdate = 0;
@@ -945,6 +1037,246 @@ const char index_html[] PROGMEM = R"rawliteral(
             "Energy Flow", "Rhythm Flash", "Harmony Glow", "Tempo Chase", "Frequency Pulse"
         ];
         
+        // WEBSOCKET CONTROL CHANNEL
+        // Command codes match CommandType in the firmware
+        const CMD = {
+            COLOR: 0, BRIGHTNESS: 1, POWER: 2, EFFECT: 3, MUSIC_PLAY: 4, MUSIC_STOP: 5,
+            MUSIC_EFFECT: 6, DENSITY: 7, ROUGHNESS: 8, EFFECT_SPEED: 9, GLOWING_SPEED: 10, PING: 11,
+            AUDIO_FRAME: 12, TIMELINE_PLAY: 13
+        };
+        let socket = null;
+        
+        function connectSocket() {
+            socket = new WebSocket(`ws://${location.host}/ws`);
+            socket.binaryType = 'arraybuffer';
+            socket.onopen = () => {
+                console.log('Control socket connected');
+                sendPing();
+            };
+            socket.onclose = () => {
+                // Keep trying - commands use HTTP until the socket is back
+                setTimeout(connectSocket, 2000);
+            };
+            socket.onmessage = (event) => applyPushedState(event.data);
+        }
+        
+        // Apply state pushed by the lamp - changes made from other phones or
+        // the touch sensor arrive here in the same command format
+        function applyPushedState(buffer) {
+            const data = new Uint8Array(buffer);
+            let pos = 0;
+            while (pos < data.length) {
+                const type = data[pos++];
+                const value = data[pos];
+                
+                if (type === CMD.PING) {
+                    const sent = new DataView(buffer).getUint32(pos);
+                    const roundTrip = ((performance.now() >>> 0) - sent) >>> 0;
+                    roundTripMs = roundTripMs ? roundTripMs * 0.7 + roundTrip * 0.3 : roundTrip;
+                    updateAudioDelay();
+                    console.log(`Control round trip: ${roundTrip} ms`);
+                    pos += 4;
+                    continue;
+                }
+                
+                if (type === CMD.COLOR) {
+                    pos += 3;
+                    continue;
+                }
+                
+                if (type === CMD.MUSIC_PLAY || type === CMD.MUSIC_STOP) {
+                    musicPlaying = (type === CMD.MUSIC_PLAY);
+                    if (!musicPlaying) stopAudio(); // Stopped from another phone
+                    musicToggleBtn.textContent = musicPlaying ? 'S' : 'R';
+                    musicToggleBtn.title = musicPlaying ? 'Stop' : 'Run';
+                    musicStatusSpan.textContent = musicPlaying ? 'Playing' : 'Stopped';
+                    continue;
+                }
+                
+                pos += 1;
+                if (type === CMD.BRIGHTNESS) {
+                    const percent = Math.round(value / 2.55);
+                    brightnessSlider.value = percent;
+                    brightnessValue.textContent = `${percent}%`;
+                } else if (type === CMD.POWER) {
+                    isOn = (value === 1);
+                    toggleBtn.style.backgroundColor = isOn ? '#87CEEB' : '#FF6B6B';
+                    toggleBtn.innerHTML = isOn ? '⚡' : '○';
+                } else if (type === CMD.EFFECT) {
+                    markActiveEffect(value); // 255 = solid color, no effect
+                } else if (type === CMD.MUSIC_EFFECT) {
+                    currentMusicEffect = value % 10;
+                    musicEffectBtn.textContent = (currentMusicEffect + 1);
+                    musicEffectBtn.title = musicEffects[currentMusicEffect];
+                    currentEffectSpan.textContent = (currentMusicEffect + 1) + "/10";
+                } else if (type === CMD.DENSITY) {
+                    densitySlider.value = value;
+                    densityValue.textContent = `${value}%`;
+                } else if (type === CMD.ROUGHNESS) {
+                    roughnessSlider.value = value;
+                    roughnessValue.textContent = `${value}%`;
+                } else if (type === CMD.EFFECT_SPEED) {
+                    effectSpeedSlider.value = value;
+                    effectSpeedValue.textContent = `${value}%`;
+                } else if (type === CMD.GLOWING_SPEED) {
+                    glowingSpeedSlider.value = value;
+                    glowingSpeedValue.textContent = `${value}%`;
+                }
+            }
+        }
+        
+        // Measure the command round trip through the lamp
+        function sendPing() {
+            const message = new DataView(new ArrayBuffer(5));
+            message.setUint8(0, CMD.PING);
+            message.setUint32(1, performance.now() >>> 0);
+            socket.send(message.buffer);
+        }
+        
+        // Send one command over the socket, or over HTTP while it is down
+        function sendCommand(type, values, fallbackUrl) {
+            if (socket && socket.readyState === WebSocket.OPEN) {
+                socket.send(new Uint8Array([type, ...values]));
+            } else {
+                fetch(fallbackUrl).catch(err => console.log('Error sending command:', err));
+            }
+        }
+        
+        // AUDIO ANALYSIS
+        // The song plays through Web Audio on this phone. An analyser sends
+        // 8 band levels to the lamp every AUDIO_FRAME_MS (it finds the beat),
+        // and a delay holds the sound back by the measured trip to the lamp
+        // so light and sound arrive together.
+        const AUDIO_BAND_EDGES = [20, 60, 150, 300, 600, 1200, 2400, 5000, 12000]; // Hz
+        const AUDIO_FRAME_MS = 20;
+        let audioContext = null;
+        let analyser = null;
+        let analyserData = null;
+        let audioDelay = null;
+        let audioTimer = null;
+        let pingTimer = null;
+        let audioSeq = 0;
+        let roundTripMs = 0;
+        let lampLatencyMs = 60; // Jitter buffer delay, read from /audio
+        let timelineName = null; // Song the lamp has a timeline for
+        
+        // Timelines are named after the song file without its extension
+        function hasTimeline() {
+            return selectedSongName.replace(/\.[^.]*$/, '') === timelineName;
+        }
+        
+        function setupAudio() {
+            if (audioContext) return;
+            audioContext = new (window.AudioContext || window.webkitAudioContext)();
+            const source = audioContext.createMediaElementSource(audioPlayer);
+            analyser = audioContext.createAnalyser();
+            analyser.fftSize = 1024;
+            analyser.smoothingTimeConstant = 0.5;
+            analyserData = new Uint8Array(analyser.frequencyBinCount);
+            audioDelay = audioContext.createDelay(1.0);
+            source.connect(analyser);          // Analysed undelayed...
+            source.connect(audioDelay);        // ...heard delayed
+            audioDelay.connect(audioContext.destination);
+            updateAudioDelay();
+        }
+        
+        function sendAudioFrame() {
+            if (!socket || socket.readyState !== WebSocket.OPEN) return;
+            if (socket.bufferedAmount > 64) return; // Lamp is behind - skip instead of queueing
+            
+            analyser.getByteFrequencyData(analyserData);
+            const binHz = audioContext.sampleRate / analyser.fftSize;
+            const sent = performance.now() & 0xFFFF; // Lamp plays frames out on this clock
+            const frame = new Uint8Array(13); // type, seq, flags (0), send time, 8 bands
+            frame[0] = CMD.AUDIO_FRAME;
+            frame[1] = audioSeq = (audioSeq + 1) & 255;
+            frame[3] = sent >> 8;
+            frame[4] = sent & 255;
+            for (let band = 0; band < 8; band++) {
+                const first = Math.max(1, Math.floor(AUDIO_BAND_EDGES[band] / binHz));
+                const last = Math.min(analyserData.length,
+                                      Math.max(first + 1, Math.floor(AUDIO_BAND_EDGES[band + 1] / binHz)));
+                let peak = 0;
+                for (let bin = first; bin < last; bin++) peak = Math.max(peak, analyserData[bin]);
+                frame[5 + band] = peak;
+            }
+            socket.send(frame);
+        }
+        
+        // One-way trip to the lamp plus the latency of its jitter buffer
+        function updateAudioDelay() {
+            if (!audioDelay) return;
+            const seconds = Math.min(0.5, (roundTripMs / 2 + lampLatencyMs) / 1000);
+            audioDelay.delayTime.setTargetAtTime(seconds, audioContext.currentTime, 0.5);
+        }
+        
+        // The lamp has this song pre-analysed: tell it where the song is
+        // when the listener hears it, and it plays the show from flash
+        function sendTimelinePlay() {
+            const position = Math.round(audioPlayer.currentTime * 1000);
+            const delay = Math.max(0, Math.round(audioDelay.delayTime.value * 1000 - roundTripMs / 2));
+            sendCommand(CMD.TIMELINE_PLAY,
+                        [position >>> 24, (position >>> 16) & 255, (position >>> 8) & 255, position & 255,
+                         delay >>> 8, delay & 255],
+                        `/timeline?play=${position}&in=${delay}`);
+        }
+        
+        function checkAudioLatency() {
+            fetch('/audio')
+                .then(response => response.json())
+                .then(info => { lampLatencyMs = info.latency; updateAudioDelay(); })
+                .catch(err => console.log('Error reading audio latency:', err));
+        }
+        
+        function checkTimeline() {
+            fetch('/timeline')
+                .then(response => response.json())
+                .then(info => { timelineName = info.name; })
+                .catch(() => { timelineName = null; });
+        }
+        
+        function startAudio() {
+            setupAudio();
+            checkAudioLatency();
+            audioContext.resume();
+            clearInterval(audioTimer);
+            clearInterval(pingTimer);
+            audioTimer = null;
+            audioPlayer.play().then(() => {
+                if (hasTimeline()) {
+                    sendTimelinePlay();
+                } else if (musicPlaying) {
+                    audioTimer = setInterval(sendAudioFrame, AUDIO_FRAME_MS);
+                }
+            });
+            pingTimer = setInterval(() => {
+                if (socket && socket.readyState === WebSocket.OPEN) sendPing();
+            }, 2000);
+        }
+        
+        function stopAudio() {
+            audioPlayer.pause();
+            clearInterval(audioTimer);
+            clearInterval(pingTimer);
+            audioTimer = null;
+            pingTimer = null;
+        }
+        
+        audioPlayer.addEventListener('ended', () => {
+            if (musicPlaying) handleMusicToggle();
+        });
+        
+        // Keep a timeline show in step after the listener seeks
+        audioPlayer.addEventListener('seeked', () => {
+            if (musicPlaying && hasTimeline()) sendTimelinePlay();
+        });
+        
+        connectSocket();
+        
+        // The lamp's schedule runs on the phone's clock until it gets SNTP
+        fetch(`/time?epoch=${Math.floor(Date.now() / 1000)}&tz=${-new Date().getTimezoneOffset()}`)
+            .catch(err => console.log('Error setting the lamp clock:', err));
+        
         // Initialize effects grid 1-60
         effects.forEach((effect, index) => {
             const effectBtn = document.createElement('button');
@@ -1053,22 +1385,27 @@ const char index_html[] PROGMEM = R"rawliteral(
         }
         
         function setQuickColor(hex) {
-            fetch('/color?hex=' + hex.substring(1)).catch(err => console.log('Error setting color:', err));
+            const value = parseInt(hex.substring(1), 16);
+            sendCommand(CMD.COLOR, [(value >> 16) & 255, (value >> 8) & 255, value & 255],
+                        '/color?hex=' + hex.substring(1));
         }
         
-        function setEffect(id) {
+        function markActiveEffect(id) {
             // Remove active class from all effect buttons
             document.querySelectorAll('.effect-btn, .white-effect-btn').forEach(b => {
                 b.classList.remove('active');
             });
             
-            // Add active class to clicked button
-            const clickedBtn = document.querySelector(`[data-id="${id}"]`);
-            if (clickedBtn) {
-                clickedBtn.classList.add('active');
+            // Add active class to the effect's button
+            const effectBtn = document.querySelector(`[data-id="${id}"]`);
+            if (effectBtn) {
+                effectBtn.classList.add('active');
             }
-            
-            fetch('/effect?id=' + id).catch(err => console.log('Error setting effect:', err));
+        }
+        
+        function setEffect(id) {
+            markActiveEffect(id);
+            sendCommand(CMD.EFFECT, [id], '/effect?id=' + id);
         }
         
         function toggleEffectsPanel(open) {
@@ -1108,6 +1445,10 @@ const char index_html[] PROGMEM = R"rawliteral(
                 
                 selectedSongName = file.name;
                 selectedSongFile = file;
+                stopAudio();
+                if (audioPlayer.src) URL.revokeObjectURL(audioPlayer.src);
+                audioPlayer.src = URL.createObjectURL(file);
+                checkTimeline();
                 songNameBox.textContent = selectedSongName;
                 currentEffectSpan.textContent = "1/10";
                 musicStatusSpan.textContent = "Ready";
@@ -1137,11 +1478,7 @@ const char index_html[] PROGMEM = R"rawliteral(
         });
         
         function handleMusicToggle() {
-            if (!selectedSongFile) {
-                alert('Please select a music file first!');
-                return;
-            }
-            
+            // Without a song the lamp listens to its microphone instead
             if (!musicPlaying) {
                 // START MUSIC PLAYBACK
                 console.log('Starting music...');
@@ -1149,28 +1486,18 @@ const char index_html[] PROGMEM = R"rawliteral(
                 musicPlaying = true;
                 musicToggleBtn.textContent = 'S';
                 musicToggleBtn.title = 'Stop';
-                musicStatusSpan.textContent = 'Playing';
+                musicStatusSpan.textContent = selectedSongFile ? 'Playing' : 'Listening';
                 
                 console.log('Music playback started on ESP8266');
                 
-                // Send play command to ESP8266
-                fetch('/music?cmd=play')
-                    .then(response => response.text())
-                    .then(data => {
-                        console.log('Play command response:', data);
-                        // Auto-close the music panel
-                        setTimeout(() => {
-                            toggleMusicPanel(false);
-                        }, 500);
-                    })
-                    .catch(err => {
-                        console.log('Error sending play command:', err);
-                        alert('Error communicating with device. Please try again.');
-                        musicPlaying = false;
-                        musicToggleBtn.textContent = 'R';
-                        musicToggleBtn.title = 'Run';
-                        musicStatusSpan.textContent = 'Error';
-                    });
+                // Send play command to ESP8266 and stream the song's levels
+                sendCommand(CMD.MUSIC_PLAY, [], '/music?cmd=play');
+                if (selectedSongFile) startAudio();
+                
+                // Auto-close the music panel
+                setTimeout(() => {
+                    toggleMusicPanel(false);
+                }, 500);
             } else {
                 // STOP MUSIC PLAYBACK
                 musicPlaying = false;
@@ -1181,15 +1508,8 @@ const char index_html[] PROGMEM = R"rawliteral(
                 console.log('Music playback stopped');
                 
                 // Send stop command to ESP8266
-                fetch('/music?cmd=stop')
-                    .then(response => response.text())
-                    .then(data => {
-                        console.log('Stop command response:', data);
-                    })
-                    .catch(err => {
-                        console.log('Error sending stop command:', err);
-                        alert('Error communicating with device. Please try again.');
-                    });
+                sendCommand(CMD.MUSIC_STOP, [], '/music?cmd=stop');
+                stopAudio();
             }
         }
         
@@ -1200,59 +1520,39 @@ const char index_html[] PROGMEM = R"rawliteral(
             currentEffectSpan.textContent = (currentMusicEffect + 1) + "/10";
             
             // Send effect change to ESP8266
-            fetch('/music?effect=' + currentMusicEffect)
-                .then(response => response.text())
-                .then(data => {
-                    console.log('Effect change response:', data);
-                })
-                .catch(err => {
-                    console.log('Error changing effect:', err);
-                    alert('Error communicating with device. Please try again.');
-                });
+            sendCommand(CMD.MUSIC_EFFECT, [currentMusicEffect], '/music?effect=' + currentMusicEffect);
         }
         
         // SLIDER EVENT LISTENERS
         brightnessSlider.addEventListener('input', () => {
             const value = brightnessSlider.value;
             brightnessValue.textContent = `${value}%`;
-            fetch(`/brightness?val=${Math.round(value * 2.55)}`)
-                .catch(err => console.log('Error setting brightness:', err));
+            const level = Math.round(value * 2.55);
+            sendCommand(CMD.BRIGHTNESS, [level], `/brightness?val=${level}`);
         });
         
         densitySlider.addEventListener('input', () => {
             const value = densitySlider.value;
             densityValue.textContent = `${value}%`;
-            fetch(`/density?val=${value}`)
-                .then(response => response.text())
-                .then(data => console.log('Density response:', data))
-                .catch(err => console.log('Error setting density:', err));
+            sendCommand(CMD.DENSITY, [value], `/density?val=${value}`);
         });
         
         roughnessSlider.addEventListener('input', () => {
             const value = roughnessSlider.value;
             roughnessValue.textContent = `${value}%`;
-            fetch(`/roughness?val=${value}`)
-                .then(response => response.text())
-                .then(data => console.log('Roughness response:', data))
-                .catch(err => console.log('Error setting roughness:', err));
+            sendCommand(CMD.ROUGHNESS, [value], `/roughness?val=${value}`);
         });
         
         effectSpeedSlider.addEventListener('input', () => {
             const value = effectSpeedSlider.value;
             effectSpeedValue.textContent = `${value}%`;
-            fetch(`/effectSpeed?val=${value}`)
-                .then(response => response.text())
-                .then(data => console.log('Effect speed response:', data))
-                .catch(err => console.log('Error setting effect speed:', err));
+            sendCommand(CMD.EFFECT_SPEED, [value], `/effectSpeed?val=${value}`);
         });
         
         glowingSpeedSlider.addEventListener('input', () => {
             const value = glowingSpeedSlider.value;
             glowingSpeedValue.textContent = `${value}%`;
-            fetch(`/glowingSpeed?val=${value}`)
-                .then(response => response.text())
-                .then(data => console.log('Glowing speed response:', data))
-                .catch(err => console.log('Error setting glowing speed:', err));
+            sendCommand(CMD.GLOWING_SPEED, [value], `/glowingSpeed?val=${value}`);
         });
         
         // EVENT LISTENERS
@@ -1264,8 +1564,7 @@ const char index_html[] PROGMEM = R"rawliteral(
             isOn = !isOn;
             toggleBtn.style.backgroundColor = isOn ? '#87CEEB' : '#FF6B6B';
             toggleBtn.innerHTML = isOn ? '⚡' : '○';
-            fetch('/toggle')
-                .catch(err => console.log('Error toggling power:', err));
+            sendCommand(CMD.POWER, [isOn ? 1 : 0], '/toggle');
         });
         
         // Color picker events
@@ -1409,303 +1708,4295 @@ const char index_html[] PROGMEM = R"rawliteral(
 </html>
 )rawliteral";
 
-// Variables for effects
-bool isPoweredOn = true;
-bool isEffectRunning = false;
-int currentEffect = 0;
-int currentBrightness = 128;
-uint32_t currentColor = strip.Color(135, 206, 235);
-unsigned long lastEffectUpdate = 0;
-int effectCounter = 0;
-int effectPosition = 0;
-int hueCounter = 0;
+// Variables for effects
+bool isPoweredOn = true;
+bool isEffectRunning = false;
+int currentEffect = 0;
+int currentBrightness = 128;
+uint32_t currentColor = strip.Color(135, 206, 235);
+unsigned long lastEffectUpdate = 0;
+int effectCounter = 0;
+int effectPosition = 0;
+int hueCounter = 0;
+
+// ========== STABILITY FUNCTIONS ==========
+void checkStack() {
+  // Check if stack canary is still intact
+  if (stackCanary != STACK_CANARY) {
+    Serial.println("STACK OVERFLOW DETECTED! Resetting...");
+    ESP.reset();
+  }
+}
+
+void feedWatchdog() {
+  // Feed the watchdog timer
+  ESP.wdtFeed();
+}
+
+// ========== PENDING CONTROL UPDATES ==========
+// Web requests are parsed in the async server's TCP callbacks, which must
+// not touch the LEDs. Handlers only record the latest requested value of
+// each setting here and loop() applies them once at the next frame
+// boundary, so a burst of slider moves costs a single strip.show().
+
+// The values double as the WebSocket wire format (see the web page's CMD
+// table) - only ever append new commands
+enum CommandType : uint8_t {
+  CMD_COLOR = 0,
+  CMD_BRIGHTNESS = 1,
+  CMD_POWER = 2,
+  CMD_EFFECT = 3,
+  CMD_MUSIC_PLAY = 4,
+  CMD_MUSIC_STOP = 5,
+  CMD_MUSIC_EFFECT = 6,
+  CMD_DENSITY = 7,
+  CMD_ROUGHNESS = 8,
+  CMD_EFFECT_SPEED = 9,
+  CMD_GLOWING_SPEED = 10,
+  CMD_PING = 11,         // WebSocket only - echoed back, never queued
+  CMD_AUDIO_FRAME = 12,  // WebSocket only - audio band levels, see AUDIO FEATURES
+  CMD_TIMELINE_PLAY = 13 // WebSocket only - start the music timeline, see MUSIC TIMELINE
+};
+
+#define COMMAND_TYPES (CMD_GLOWING_SPEED + 1) // Commands that carry state
+#define NO_EFFECT 255                         // Effect value meaning solid color
+#define POWER_TOGGLE (-1)                     // CMD_POWER values: flip the power in loop()
+#define POWER_KEEP (-2)                       // ... or leave it (two toggles in one frame)
+
+struct ControlCommand {
+  uint8_t type;
+  int32_t value;
+  unsigned long queuedMicros; // For the request latency stats
+};
+
+ControlCommand pendingCommands[COMMAND_TYPES]; // Latest value per command type
+volatile uint16_t pendingMask = 0;             // Bit set per type waiting to be applied
+unsigned long controlRequestsReceived = 0;
+unsigned long controlUpdatesApplied = 0;
+unsigned long controlFramesApplied = 0;        // Frames that applied updates (one show() each)
+unsigned long wsCommands = 0;      // Commands received over the WebSocket
+unsigned long wsHandlerMicros = 0; // Time spent parsing them
+unsigned long statePushes = 0;     // State change broadcasts to all pages
+
+// Record a requested change - last write wins until the next frame
+bool queueCommand(uint8_t type, int32_t value) {
+  if (type >= COMMAND_TYPES) return false;
+  
+  pendingCommands[type].type = type;
+  pendingCommands[type].value = value;
+  pendingCommands[type].queuedMicros = micros();
+  pendingMask |= (1 << type);
+  controlRequestsReceived++;
+  return true;
+}
+
+// Flip the power when the commands are applied - every toggle that
+// arrives in the same frame counts, on top of any on/off queued before it
+bool queuePowerToggle() {
+  int32_t value = POWER_TOGGLE;
+  if (pendingMask & (1 << CMD_POWER)) {
+    int32_t pending = pendingCommands[CMD_POWER].value;
+    if (pending == POWER_TOGGLE) value = POWER_KEEP;
+    else if (pending == POWER_KEEP) value = POWER_TOGGLE;
+    else value = !pending;
+  }
+  return queueCommand(CMD_POWER, value);
+}
+
+// ========== FRAME AND REQUEST STATS ==========
+#define LATENCY_BUCKETS 20 // Bucket i counts latencies of 2^i to 2^(i+1) us
+
+// Frame timing stats
+unsigned long lastLoopMicros = 0;
+unsigned long maxFrameGapMicros = 0;      // Longest loop gap since boot
+unsigned long pageLoadFrameGapMicros = 0; // Longest loop gap during the last page load
+unsigned long pageLoads = 0;
+int activePageLoads = 0;
+
+// Request-to-applied latency histogram
+uint32_t latencyHistogram[LATENCY_BUCKETS];
+uint32_t latencySamples = 0;
+
+// Lowest free heap seen - with heapMaxBlock in /stats this shows whether
+// request handling leaks or fragments memory over a long run
+uint32_t minFreeHeap = 0xFFFFFFFF;
+
+// Boot timing, ms since reset
+unsigned long bootFirstFrameMillis = 0; // Saved settings on the LEDs
+unsigned long bootReadyMillis = 0;      // Access point (or station join) and web server up
+bool bootSelfTest = false;              // This boot ran the full self-test
+volatile bool selfTestRequested = false; // GET /selftest, run from loop()
+
+// Track the time between loop iterations (one iteration renders one frame)
+void updateFrameStats() {
+  unsigned long nowMicros = micros();
+  unsigned long gap = nowMicros - lastLoopMicros;
+  lastLoopMicros = nowMicros;
+  
+  if (gap > maxFrameGapMicros) maxFrameGapMicros = gap;
+  if (activePageLoads > 0 && gap > pageLoadFrameGapMicros) pageLoadFrameGapMicros = gap;
+  
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < minFreeHeap) minFreeHeap = freeHeap;
+}
+
+void recordLatency(unsigned long latencyMicros) {
+  uint8_t bucket = 0;
+  while (latencyMicros > 1 && bucket < LATENCY_BUCKETS - 1) {
+    latencyMicros >>= 1;
+    bucket++;
+  }
+  latencyHistogram[bucket]++;
+  latencySamples++;
+}
+
+// Upper bound in us of the histogram bucket holding the given percentile
+unsigned long latencyPercentile(uint8_t percent) {
+  if (latencySamples == 0) return 0;
+  
+  uint32_t count = 0;
+  for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+    count += latencyHistogram[i];
+    if ((uint64_t)count * 100 >= (uint64_t)latencySamples * percent) {
+      return 2UL << i;
+    }
+  }
+  return 2UL << (LATENCY_BUCKETS - 1);
+}
+
+// ========== REALTIME UDP PIXEL STREAMING ==========
+// A PC can drive the LEDs directly with DDP (port 4048) or E1.31/sACN
+// (port 5568, universe 1, unicast or multicast). Pixel data is read from
+// the UDP packet straight into the strip's pixel buffer and converted in
+// place. When no packet arrives for REALTIME_TIMEOUT ms the lamp goes back
+// to its own effects. tools/ddp_send.py is a matching test sender.
+#define DDP_PORT 4048
+#define E131_PORT 5568
+#define E131_UNIVERSE 1
+#define REALTIME_TIMEOUT 2500   // ms without packets before effects resume
+#define REALTIME_MAX_PACKETS 4  // Packets handled per loop iteration
+#define DDP_HEADER_SIZE 10
+#define DDP_TIMECODE_SIZE 4
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_FLAG_PUSH 0x01
+#define DDP_FLAG_QUERY 0x02
+#define E131_HEADER_SIZE 126    // Up to and including the DMX start code
+
+WiFiUDP ddpUdp;
+WiFiUDP e131Udp;
+
+bool realtimeActive = false;
+unsigned long lastRealtimePacket = 0;
+uint8_t lastDdpSequence = 0;     // 0 = sender does not use sequence numbers
+int lastE131Sequence = -1;
+
+// Realtime stats
+unsigned long realtimePackets = 0;
+unsigned long realtimeLost = 0;
+unsigned long realtimeFrames = 0;
+unsigned long realtimeFps = 0;
+unsigned long realtimeLatencyMaxMicros = 0;  // Packet read to strip.show()
+unsigned long realtimeLatencyTotalMicros = 0;
+
+// Convert freshly received RGB bytes in the pixel buffer to the strip's
+// GRB order and apply the brightness, like setPixelColor() would
+void convertRealtimePixels(uint8_t *pixels, size_t len) {
+  uint16_t scale = strip.getBrightness() + 1;
+  for (size_t i = 0; i + 2 < len; i += 3) {
+    uint8_t r = pixels[i];
+    pixels[i] = (pixels[i + 1] * scale) >> 8;
+    pixels[i + 1] = (r * scale) >> 8;
+    pixels[i + 2] = (pixels[i + 2] * scale) >> 8;
+  }
+}
+
+void showRealtimeFrame(unsigned long packetMicros) {
+  strip.show();
+  
+  unsigned long latency = micros() - packetMicros;
+  realtimeLatencyTotalMicros += latency;
+  if (latency > realtimeLatencyMaxMicros) realtimeLatencyMaxMicros = latency;
+  realtimeFrames++;
+}
+
+// Back to the effects - on timeout, or when the sender says it is done
+void endRealtime(const char *reason) {
+  realtimeActive = false;
+  lastDdpSequence = 0;
+  lastE131Sequence = -1;
+  Serial.print("Realtime UDP stream ");
+  Serial.print(reason);
+  Serial.println(" - back to effects");
+  
+  // Effects redraw themselves; a solid color has to be restored here
+  for (int i = 0; i < NUM_LEDS; i++) {
+    strip.setPixelColor(i, (isPoweredOn && !isEffectRunning) ? currentColor : 0);
+  }
+  strip.show();
+}
+
+// Returns true if the packet carried pixel data
+bool readDdpPacket(unsigned long packetMicros) {
+  uint8_t header[DDP_HEADER_SIZE];
+  if (ddpUdp.read(header, DDP_HEADER_SIZE) != DDP_HEADER_SIZE) return false;
+  
+  uint8_t flags = header[0];
+  if ((flags >> 6) != 1 || (flags & DDP_FLAG_QUERY)) return false; // Version 1 data only
+  if (flags & DDP_FLAG_TIMECODE) {
+    uint8_t timecode[DDP_TIMECODE_SIZE];
+    ddpUdp.read(timecode, DDP_TIMECODE_SIZE);
+  }
+  
+  // Sequence numbers run 1..15, 0 means unused
+  uint8_t sequence = header[1] & 0x0F;
+  if (sequence && lastDdpSequence) {
+    realtimeLost += (sequence - (lastDdpSequence % 15 + 1) + 15) % 15;
+  }
+  lastDdpSequence = sequence;
+  
+  uint32_t offset = ((uint32_t)header[4] << 24) | ((uint32_t)header[5] << 16) |
+                    ((uint32_t)header[6] << 8) | header[7];
+  uint16_t length = ((uint16_t)header[8] << 8) | header[9];
+  
+  const size_t bufferSize = NUM_LEDS * 3;
+  if (offset % 3 == 0 && offset < bufferSize) {
+    uint8_t *pixels = strip.getPixels() + offset;
+    size_t count = bufferSize - offset;
+    if (length < count) count = length;
+    count = ddpUdp.read(pixels, count);
+    convertRealtimePixels(pixels, count);
+  }
+  
+  // Show on push, or when a sender without push filled the last pixel
+  if ((flags & DDP_FLAG_PUSH) || offset + length >= bufferSize) {
+    showRealtimeFrame(packetMicros);
+  }
+  return true;
+}
+
+bool readE131Packet(unsigned long packetMicros) {
+  uint8_t header[E131_HEADER_SIZE];
+  if (e131Udp.read(header, E131_HEADER_SIZE) != E131_HEADER_SIZE) return false;
+  
+  // ACN packet identifier, root/framing/DMP vectors and universe
+  if (memcmp(header + 4, "ASC-E1.17", 9) != 0) return false;
+  if (header[21] != 0x04 || header[43] != 0x02 || header[117] != 0x02) return false;
+  if ((((uint16_t)header[113] << 8) | header[114]) != E131_UNIVERSE) return false;
+  if (header[112] & 0x80) return false; // Preview data - not for output
+  if (header[112] & 0x40) {               // Stream terminated - no need to wait for the timeout
+    if (realtimeActive) endRealtime("terminated");
+    return false;
+  }
+  if (header[125] != 0) return false;   // Only the null start code carries levels
+  
+  // Property value count: the start code plus the channels - whole pixels only
+  uint16_t values = ((uint16_t)header[123] << 8) | header[124];
+  if (values < 1 + 3) return false;
+  size_t count = values - 1;
+  if (count > NUM_LEDS * 3) count = NUM_LEDS * 3;
+  count -= count % 3;
+  if (e131Udp.available() < (int)count) return false; // Shorter than its header says
+  
+  uint8_t sequence = header[111];
+  if (lastE131Sequence >= 0) {
+    uint8_t missed = sequence - (uint8_t)(lastE131Sequence + 1);
+    if (missed < 128) realtimeLost += missed; // Larger jumps are reordering or a restart
+  }
+  lastE131Sequence = sequence;
+  
+  count = e131Udp.read(strip.getPixels(), count);
+  convertRealtimePixels(strip.getPixels(), count);
+  
+  showRealtimeFrame(packetMicros);
+  return true;
+}
+
+// Handle waiting pixel packets; returns true while a PC owns the LEDs
+bool handleRealtimeUdp() {
+  for (uint8_t i = 0; i < REALTIME_MAX_PACKETS; i++) {
+    bool received = false;
+    
+    if (ddpUdp.parsePacket() > 0) {
+      received = readDdpPacket(micros());
+    } else if (e131Udp.parsePacket() > 0) {
+      received = readE131Packet(micros());
+    } else {
+      break;
+    }
+    
+    if (received) {
+      realtimePackets++;
+      lastRealtimePacket = millis();
+      if (!realtimeActive) {
+        realtimeActive = true;
+        Serial.println("Realtime UDP stream started");
+      }
+    }
+  }
+  
+  // Frames shown in the last second
+  static unsigned long lastFpsUpdate = 0;
+  static unsigned long lastFrameCount = 0;
+  if (millis() - lastFpsUpdate >= 1000) {
+    lastFpsUpdate = millis();
+    realtimeFps = realtimeFrames - lastFrameCount;
+    lastFrameCount = realtimeFrames;
+  }
+  
+  if (realtimeActive && millis() - lastRealtimePacket > REALTIME_TIMEOUT) {
+    endRealtime("timed out");
+  }
+  
+  return realtimeActive;
+}
+
+// ========== MULTI-LAMP SYNC ==========
+// Lamps on the same network can render in lockstep. The leader multicasts
+// a beacon with its clock and effect state; followers steer a local copy
+// of the leader's clock (offset plus drift) and switch to its effect.
+// Effects step on slots of effectMillis() (effectStepDue()), so once the
+// clocks agree every lamp steps the same frame at the same moment, and
+// the leader's counters are only taken over when a follower's have come
+// apart. Effects that use random() still pick their own random values.
+// tools/sync_sim.py runs this on a PC with several lamps.
+#define SYNC_PORT 4211
+#define SYNC_MAGIC 0x4F524753    // "SGRO"
+#define SYNC_BEACON_INTERVAL 250 // ms between leader beacons
+#define SYNC_TIMEOUT 3000        // ms without beacons before a follower unlocks
+#define SYNC_PHASE_GAIN 0.25f    // Share of each clock error corrected at once
+#define SYNC_DRIFT_GAIN 0.05f    // Share of each clock error fed into the drift
+#define SYNC_COUNTER_SLACK 2     // Steps a follower's effect may be off before it takes the leader's
+#define EFFECT_CATCH_UP_STEPS 8  // Skipped effect steps made up after a stall, more are dropped
+
+enum SyncRole : uint8_t {
+  SYNC_OFF,
+  SYNC_LEADER,
+  SYNC_FOLLOWER
+};
+
+struct SyncBeacon {
+  uint32_t magic;
+  uint64_t leaderMicros;
+  uint8_t effect;
+  uint8_t effectRunning;
+  uint8_t musicEffect;
+  uint8_t musicPlaying;
+  int32_t effectCounter;
+  int32_t effectPosition;
+  int32_t hueCounter;
+  uint32_t lastEffectUpdate;     // In shared-clock milliseconds
+  int32_t musicEffectCounter;
+  int32_t musicEffectPosition;
+  uint32_t lastMusicUpdate;
+} __attribute__((packed));
+
+IPAddress syncGroup(239, 79, 82, 71);
+WiFiUDP syncUdp;
+
+volatile uint8_t syncRole = SYNC_OFF;
+bool syncLocked = false;
+int64_t syncOffsetMicros = 0;  // Leader clock minus local clock at the anchor
+uint64_t syncAnchorMicros = 0; // Local time of the last correction
+float syncDrift = 0;           // Leader clock rate minus local clock rate
+unsigned long lastSyncBeacon = 0;
+
+// Sync stats
+unsigned long syncBeacons = 0;
+int32_t syncLastErrorMicros = 0; // Leader clock minus our estimate at the last beacon
+uint32_t syncSkewMicros = 0;     // Smoothed size of that error
+unsigned long syncAdoptions = 0; // Times the effect counters were taken from the leader
+
+// Shared clock: the leader's clock on followers, the local clock otherwise
+uint64_t sharedMicros() {
+  uint64_t now = micros64();
+  if (!syncLocked) return now;
+  return now + syncOffsetMicros + (int64_t)(syncDrift * (int64_t)(now - syncAnchorMicros));
+}
+
+// Time base for all effects
+unsigned long effectMillis() {
+  return sharedMicros() / 1000;
+}
+
+// True once per effect step. Steps fall on slots of interval + 1 ms of the
+// shared clock, not whenever loop() got there, so synced lamps step
+// together and count the same steps. Steps a short stall skipped are
+// caught up one per pass; after a longer one the effect skips ahead.
+bool effectStepDue(unsigned long interval) {
+  unsigned long period = interval + 1;
+  unsigned long now = effectMillis();
+  if (now - lastEffectUpdate < period) return false;
+  
+  unsigned long slot = now - now % period;
+  if (lastEffectUpdate % period == 0 && slot - lastEffectUpdate <= period * EFFECT_CATCH_UP_STEPS) {
+    lastEffectUpdate += period;
+  } else {
+    lastEffectUpdate = slot;
+  }
+  return true;
+}
+
+void sendSyncBeacon() {
+  SyncBeacon beacon;
+  beacon.magic = SYNC_MAGIC;
+  beacon.effect = currentEffect;
+  beacon.effectRunning = isEffectRunning;
+  beacon.musicEffect = currentMusicEffect;
+  beacon.musicPlaying = musicPlaying;
+  beacon.effectCounter = effectCounter;
+  beacon.effectPosition = effectPosition;
+  beacon.hueCounter = hueCounter;
+  beacon.lastEffectUpdate = lastEffectUpdate;
+  beacon.musicEffectCounter = musicEffectCounter;
+  beacon.musicEffectPosition = musicEffectPosition;
+  beacon.lastMusicUpdate = lastMusicUpdate;
+  
+  syncUdp.beginPacketMulticast(syncGroup, SYNC_PORT, lampIP());
+  beacon.leaderMicros = sharedMicros(); // As late as possible
+  syncUdp.write((const uint8_t *)&beacon, sizeof(beacon));
+  syncUdp.endPacket();
+  syncBeacons++;
+}
+
+// Counters further apart than the slack (a wrap counts too - one step)
+bool syncCounterOff(int32_t local, int32_t leader) {
+  int32_t off = local - leader;
+  return off > SYNC_COUNTER_SLACK || off < -SYNC_COUNTER_SLACK;
+}
+
+void receiveSyncBeacon(const SyncBeacon &beacon) {
+  uint64_t now = micros64();
+  bool wasLocked = syncLocked;
+  
+  if (!syncLocked) {
+    // First beacon - jump straight to the leader's clock
+    syncOffsetMicros = (int64_t)(beacon.leaderMicros - now);
+    syncAnchorMicros = now;
+    syncDrift = 0;
+    syncLocked = true;
+    Serial.println("Sync: locked to leader");
+  } else {
+    // Steer towards the leader: correct part of the phase error now and
+    // let the rest adjust the drift estimate
+    uint64_t estimate = sharedMicros();
+    int64_t error = (int64_t)(beacon.leaderMicros - estimate);
+    int64_t elapsed = (int64_t)(now - syncAnchorMicros);
+    
+    syncOffsetMicros = (int64_t)(estimate - now) + (int64_t)(error * SYNC_PHASE_GAIN);
+    if (elapsed > 0) syncDrift += SYNC_DRIFT_GAIN * (float)error / (float)elapsed;
+    syncAnchorMicros = now;
+    
+    syncLastErrorMicros = error;
+    uint32_t magnitude = error < 0 ? -error : error;
+    syncSkewMicros = (syncSkewMicros * 7 + magnitude) / 8;
+  }
+  
+  // Render the leader's effect from the leader's position. Once both run
+  // the same effect they step on the same clock slots, so the counters
+  // are only taken over when they have come apart: the snapshot is a few
+  // ms old on arrival, and taking it every time set the follower back and
+  // forth by a step.
+  bool switched = !wasLocked || currentEffect != beacon.effect ||
+                  isEffectRunning != (bool)beacon.effectRunning ||
+                  currentMusicEffect != beacon.musicEffect ||
+                  musicPlaying != (bool)beacon.musicPlaying;
+  currentEffect = beacon.effect;
+  isEffectRunning = beacon.effectRunning;
+  currentMusicEffect = beacon.musicEffect;
+  musicPlaying = beacon.musicPlaying;
+  if (switched || syncCounterOff(effectCounter, beacon.effectCounter) ||
+      syncCounterOff(effectPosition, beacon.effectPosition) ||
+      syncCounterOff(hueCounter, beacon.hueCounter)) {
+    effectCounter = beacon.effectCounter;
+    effectPosition = beacon.effectPosition;
+    hueCounter = beacon.hueCounter;
+    lastEffectUpdate = beacon.lastEffectUpdate;
+    syncAdoptions++;
+  }
+  if (switched || syncCounterOff(musicEffectCounter, beacon.musicEffectCounter) ||
+      syncCounterOff(musicEffectPosition, beacon.musicEffectPosition)) {
+    musicEffectCounter = beacon.musicEffectCounter;
+    musicEffectPosition = beacon.musicEffectPosition;
+    lastMusicUpdate = beacon.lastMusicUpdate;
+  }
+  
+  lastSyncBeacon = millis();
+  syncBeacons++;
+}
+
+void handleLampSync() {
+  if (syncRole == SYNC_LEADER) {
+    if (millis() - lastSyncBeacon >= SYNC_BEACON_INTERVAL) {
+      lastSyncBeacon = millis();
+      sendSyncBeacon();
+    }
+    syncLocked = false; // The leader's own clock is the shared clock
+  } else if (syncRole == SYNC_FOLLOWER) {
+    SyncBeacon beacon;
+    while (syncUdp.parsePacket() > 0) {
+      if (syncUdp.read((uint8_t *)&beacon, sizeof(beacon)) == sizeof(beacon) &&
+          beacon.magic == SYNC_MAGIC) {
+        receiveSyncBeacon(beacon);
+      }
+    }
+    if (syncLocked && millis() - lastSyncBeacon > SYNC_TIMEOUT) {
+      syncLocked = false;
+      Serial.println("Sync: leader lost - running on local clock");
+    }
+  } else {
+    syncLocked = false;
+  }
+}
+
+// ========== AUDIO FEATURES ==========
+// While a song plays on the phone the page analyses it with Web Audio and
+// streams AUDIO_BANDS band levels (low to high) about 50 times a second
+// over the control socket as CMD_AUDIO_FRAME. Every frame carries the
+// page's clock, and a jitter buffer plays the frames out on the lamp's
+// clock a fixed latency behind the fastest frame seen lately: WiFi bursts
+// and reordering are absorbed, frames that never arrive are interpolated
+// from their neighbours. Each frame played also goes through the beat
+// tracker. Without frames for AUDIO_TIMEOUT ms the music effects animate
+// on their own as before. The microphone feeds the same buffer with no
+// added latency.
+#define AUDIO_BANDS 8
+#define AUDIO_FRAME_SIZE (4 + AUDIO_BANDS) // seq, flags (reserved, 0), send time ms (2 bytes), bands
+#define AUDIO_RING_SIZE 32                 // Power of two, a slot per sequence number
+#define AUDIO_LATENCY_TARGET 60            // Default playout delay behind the fastest frame, ms
+#define AUDIO_LATENCY_MAX 500              // The page can delay its sound by this much at most
+#define AUDIO_TRANSIT_WINDOW 2000          // ms per window of the fastest-trip estimate
+#define AUDIO_TIMEOUT 500                  // ms without frames before effects run on their own
+
+enum AudioSource { AUDIO_SOURCE_PAGE, AUDIO_SOURCE_MIC };
+
+struct AudioFrame {
+  uint8_t bands[AUDIO_BANDS];
+  uint8_t seq;
+  bool filled;
+  unsigned long sentMillis;      // Sender clock, unwrapped
+  unsigned long receivedMicros;
+};
+
+// The socket handler and the render loop both run on the one Arduino task,
+// never at the same time, so the slots need no locking
+AudioFrame audioRing[AUDIO_RING_SIZE];
+uint8_t audioSource = AUDIO_SOURCE_PAGE;
+bool audioStreaming = false;
+uint8_t audioPlaySeq = 0;                // Next sequence number to play out
+uint16_t audioLatencyTarget = AUDIO_LATENCY_TARGET; // Set with /audio?latency=
+unsigned long lastAudioSent = 0;         // Newest sender time
+unsigned long lastAudioReceived = 0;
+unsigned long lastAudioDue = 0;          // Playout time of the last frame played
+unsigned long audioFrameInterval = 20;   // ms between frames at the sender, smoothed
+bool audioStarved = false;
+
+// Fastest trip (receive time minus send time, in unrelated clocks) in this
+// window and the last one - the playout clock runs this far behind the sender
+unsigned long audioTransitMin = 0;
+unsigned long audioTransitPrevMin = 0;
+unsigned long audioTransitWindowStart = 0;
+
+// Levels of the frame being rendered
+uint8_t audioLevels[AUDIO_BANDS];
+bool audioOnset = false;           // An onset arrived with this frame
+bool audioLive = false;
+bool audioBassOnly = false;        // From the microphone, which hears nothing above MIC_TOP_HZ
+unsigned long lastAudioFrame = 0;
+
+// Audio stats
+unsigned long audioFrames = 0;
+unsigned long audioLost = 0;       // Missing at playout - interpolated
+unsigned long audioLate = 0;       // Arrived after their playout time - dropped
+unsigned long audioUnderruns = 0;  // Buffer ran dry while the stream went on
+unsigned long audioSkipped = 0;    // Played out without being rendered to catch up
+unsigned long audioAgeMicros = 0;  // Smoothed receive-to-render time
+unsigned long audioLatencyMicros = 0;  // Smoothed fastest-trip-to-render time
+unsigned long audioJitterMicros = 0;   // Smoothed trip above the fastest
+unsigned long audioJitterMax = 0;      // Slowest trip above the fastest this window, ms
+unsigned long audioJitterPrevMax = 0;
+
+unsigned long audioFastestTransit() {
+  return (long)(audioTransitPrevMin - audioTransitMin) < 0 ? audioTransitPrevMin : audioTransitMin;
+}
+
+// Called from the socket handler and the microphone with seq, flags, send
+// time and the band levels
+void pushAudioFrame(const uint8_t *payload, uint8_t source) {
+  unsigned long now = millis();
+  uint8_t seq = payload[0];
+  uint16_t sent16 = ((uint16_t)payload[2] << 8) | payload[3];
+  int8_t ahead = seq - audioPlaySeq;
+  
+  // A new stream: after a pause, from the other source, or too far ahead to hold
+  if (!audioStreaming || source != audioSource || now - lastAudioReceived > AUDIO_TIMEOUT ||
+      ahead >= AUDIO_RING_SIZE) {
+    for (uint8_t i = 0; i < AUDIO_RING_SIZE; i++) audioRing[i].filled = false;
+    audioStreaming = true;
+    audioSource = source;
+    audioPlaySeq = seq;
+    audioStarved = false;
+    ahead = 0;
+    lastAudioSent = sent16;
+    audioTransitMin = audioTransitPrevMin = now - lastAudioSent;
+    audioTransitWindowStart = now;
+    lastAudioDue = now;
+  }
+  lastAudioReceived = now;
+  
+  // Unwrap the 16 bit send time against the newest frame
+  unsigned long sent = lastAudioSent + (int16_t)(sent16 - (uint16_t)lastAudioSent);
+  if ((long)(sent - lastAudioSent) > 0) {
+    unsigned long step = sent - lastAudioSent;
+    if (step < 200) audioFrameInterval = (audioFrameInterval * 7 + step) / 8;
+    lastAudioSent = sent;
+  }
+  
+  // Track the fastest trip; the estimate restarts every window so it
+  // follows the two clocks drifting apart
+  unsigned long transit = now - sent;
+  if (now - audioTransitWindowStart > AUDIO_TRANSIT_WINDOW) {
+    audioTransitPrevMin = audioTransitMin;
+    audioTransitMin = transit;
+    audioTransitWindowStart = now;
+    audioJitterPrevMax = audioJitterMax;
+    audioJitterMax = 0;
+  } else if ((long)(transit - audioTransitMin) < 0) {
+    audioTransitMin = transit;
+  }
+  unsigned long jitter = transit - audioFastestTransit();
+  if ((long)jitter < 0) jitter = 0;
+  audioJitterMicros = (audioJitterMicros * 15 + jitter * 1000) / 16;
+  if (jitter > audioJitterMax) audioJitterMax = jitter;
+  
+  if (ahead < 0) {
+    audioLate++; // Already played or interpolated
+    return;
+  }
+  AudioFrame &frame = audioRing[seq & (AUDIO_RING_SIZE - 1)];
+  memcpy(frame.bands, payload + 4, AUDIO_BANDS);
+  frame.seq = seq;
+  frame.sentMillis = sent;
+  frame.receivedMicros = micros();
+  frame.filled = true;
+}
+
+// Play out every frame that is due into audioLevels - false when none was
+bool takeAudioFrame() {
+  unsigned long now = millis();
+  if (audioStreaming && now - lastAudioReceived > AUDIO_TIMEOUT) audioStreaming = false;
+  if (audioLive && now - lastAudioFrame > AUDIO_TIMEOUT) audioLive = false;
+  if (!audioStreaming) return false;
+  
+  // A frame is due at its send time plus the fastest trip plus the latency
+  unsigned long latency = audioSource == AUDIO_SOURCE_PAGE ? audioLatencyTarget : 0;
+  unsigned long offset = audioFastestTransit() + latency;
+  uint8_t played = 0;
+  unsigned long due = 0;
+  unsigned long receivedMicros = 0;
+  audioOnset = false;
+  
+  // Earlier due frames still go through the beat tracker, at their own time
+  for (;;) {
+    AudioFrame &frame = audioRing[audioPlaySeq & (AUDIO_RING_SIZE - 1)];
+    if (frame.filled && frame.seq == audioPlaySeq) {
+      due = frame.sentMillis + offset;
+      if ((long)(now - due) < 0) break;
+      memcpy(audioLevels, frame.bands, AUDIO_BANDS);
+      receivedMicros = frame.receivedMicros;
+      frame.filled = false;
+    } else {
+      // Missing - fill in on the way to the next frame that did arrive
+      uint8_t gap = 1;
+      AudioFrame *later = NULL;
+      for (; gap < AUDIO_RING_SIZE; gap++) {
+        AudioFrame &candidate = audioRing[(uint8_t)(audioPlaySeq + gap) & (AUDIO_RING_SIZE - 1)];
+        if (candidate.filled && candidate.seq == (uint8_t)(audioPlaySeq + gap)) {
+          later = &candidate;
+          break;
+        }
+      }
+      if (!later) {
+        // Counted once frames come again, not when the stream just ends
+        if ((long)(now - lastAudioDue) > (long)(audioFrameInterval * 2)) audioStarved = true;
+        break;
+      }
+      due = lastAudioDue + (long)(later->sentMillis + offset - lastAudioDue) / (gap + 1);
+      if ((long)(now - due) < 0) break;
+      for (uint8_t i = 0; i < AUDIO_BANDS; i++) {
+        audioLevels[i] += ((int)later->bands[i] - audioLevels[i]) / (gap + 1);
+      }
+      audioLost++;
+    }
+    
+    audioOnset |= detectOnset(audioLevels, due);
+    lastAudioDue = due;
+    audioPlaySeq++;
+    if (audioStarved) audioUnderruns++;
+    audioStarved = false;
+    if (played++) audioSkipped++;
+  }
+  if (!played) return false;
+  
+  if (receivedMicros) audioAgeMicros = (audioAgeMicros * 7 + (micros() - receivedMicros)) / 8;
+  audioLatencyMicros = (audioLatencyMicros * 7 + (now - lastAudioDue + latency) * 1000) / 8;
+  audioLive = true;
+  audioBassOnly = audioSource == AUDIO_SOURCE_MIC;
+  lastAudioFrame = now;
+  audioFrames++;
+  return true;
+}
+
+// Loudest band in [first, last)
+uint8_t audioPeak(uint8_t first, uint8_t last) {
+  uint8_t peak = 0;
+  for (uint8_t i = first; i < last; i++) {
+    if (audioLevels[i] > peak) peak = audioLevels[i];
+  }
+  return peak;
+}
+
+uint8_t audioBass() { return audioPeak(0, 2); }
+
+uint8_t audioEnergy() {
+  uint16_t sum = 0;
+  for (uint8_t i = 0; i < AUDIO_BANDS; i++) sum += audioLevels[i];
+  return sum / AUDIO_BANDS;
+}
+
+// The microphone's top bands are still bass - treble effects follow the
+// overall level instead of sitting on the sub-bass
+uint8_t audioTreble() {
+  return audioBassOnly ? audioEnergy() : audioPeak(AUDIO_BANDS - 2, AUDIO_BANDS);
+}
+
+// ========== BEAT TRACKING ==========
+// Runs once per audio frame, whatever its source. An onset is a jump in
+// spectral flux (the summed rise of every band, bass counted twice) above
+// an adaptive threshold: ONSET_SENSITIVITY percent of the recent average.
+// Intervals between each onset and the last few vote into a decaying
+// histogram; the beat period (60-200 BPM) is the one whose multiples
+// explain most of those intervals, which keeps it from settling on half
+// or double the tempo. A phase-locked beat clock runs at that period, is
+// pulled towards onsets that land near a predicted beat, and keeps
+// ticking through breaks. Effects read beatPhase (0-255 through each beat)
+// and beatTick (set when a beat starts, cleared after the next rendered
+// music frame). tools/beat_check.py runs
+// the same steps on a WAV file for checking on a PC.
+#define ONSET_HISTORY 16          // Frames in the flux average
+#define ONSET_SENSITIVITY 160     // Flux must exceed this % of the average
+#define ONSET_MIN_FLUX 24         // ...and this, so noise never counts
+#define ONSET_REFRACTORY 120      // ms between onsets
+#define BEAT_MIN_PERIOD 300       // ms (200 BPM)
+#define BEAT_MAX_PERIOD 1000      // ms (60 BPM)
+#define BEAT_MIN_INTERVAL 150     // ms, range of onset intervals counted
+#define BEAT_MAX_INTERVAL 2000
+#define BEAT_BIN_MS 10
+#define BEAT_BINS ((BEAT_MAX_INTERVAL - BEAT_MIN_INTERVAL) / BEAT_BIN_MS + 1)
+#define BEAT_ONSETS 8             // Earlier onsets each new one is compared with
+#define BEAT_LOCK_ONSETS 4        // Onsets before the beat clock starts
+#define BEAT_LOST_TIMEOUT 4000    // ms without onsets before the clock stops
+
+uint8_t prevBands[AUDIO_BANDS];
+uint16_t fluxHistory[ONSET_HISTORY];
+uint8_t fluxIndex = 0;
+uint32_t fluxSum = 0;
+
+unsigned long onsetTimes[BEAT_ONSETS];
+uint8_t onsetIndex = 0;
+uint8_t onsetsSinceLock = 0;
+unsigned long lastOnset = 0;
+uint16_t intervalVotes[BEAT_BINS];
+
+uint16_t beatPeriod = 500;        // ms
+unsigned long nextBeat = 0;       // Predicted time of the next beat
+bool beatLocked = false;
+uint8_t beatPhase = 0;
+bool beatTick = false;
+
+// Beat stats
+unsigned long onsets = 0;
+unsigned long beats = 0;
+int16_t beatPhaseError = 0;       // Last onset minus the nearest predicted beat, ms
+
+void voteInterval(unsigned long interval, uint8_t weight) {
+  if (interval < BEAT_MIN_INTERVAL || interval > BEAT_MAX_INTERVAL) return;
+  uint16_t bin = (interval - BEAT_MIN_INTERVAL + BEAT_BIN_MS / 2) / BEAT_BIN_MS;
+  if (bin >= BEAT_BINS) bin = BEAT_BINS - 1;
+  intervalVotes[bin] += weight * 2;
+  if (bin > 0) intervalVotes[bin - 1] += weight;
+  if (bin + 1 < BEAT_BINS) intervalVotes[bin + 1] += weight;
+}
+
+// How well a beat period explains the intervals: its own votes plus those
+// of its multiples, further multiples counting less
+uint32_t tempoScore(uint16_t period) {
+  uint32_t score = 0;
+  for (uint8_t k = 1; k * period <= BEAT_MAX_INTERVAL; k++) {
+    score += (uint32_t)intervalVotes[(k * period - BEAT_MIN_INTERVAL) / BEAT_BIN_MS] * 12 / k;
+  }
+  return score;
+}
+
+void trackTempo(unsigned long now) {
+  for (uint16_t i = 0; i < BEAT_BINS; i++) intervalVotes[i] -= intervalVotes[i] >> 4;
+  
+  // Neighbouring onsets count most
+  for (uint8_t i = 1; i <= BEAT_ONSETS; i++) {
+    unsigned long previous = onsetTimes[(onsetIndex + BEAT_ONSETS - i) % BEAT_ONSETS];
+    if (previous == 0) break;
+    voteInterval(now - previous, i <= 2 ? 4 : 2);
+  }
+  onsetTimes[onsetIndex] = now;
+  onsetIndex = (onsetIndex + 1) % BEAT_ONSETS;
+  
+  uint16_t best = 0;
+  uint32_t bestScore = 0;
+  for (uint16_t period = BEAT_MIN_PERIOD; period <= BEAT_MAX_PERIOD; period += BEAT_BIN_MS) {
+    uint32_t score = tempoScore(period);
+    if (score > bestScore) {
+      best = period;
+      bestScore = score;
+    }
+  }
+  if (bestScore == 0) return;
+  
+  // Onsets that sit on that period's grid give its exact length - the
+  // longest spans average out the frame timing best
+  uint32_t span = 0, beatsInSpan = 0;
+  for (uint8_t i = 2; i <= BEAT_ONSETS; i++) {
+    unsigned long previous = onsetTimes[(onsetIndex + BEAT_ONSETS - i) % BEAT_ONSETS];
+    if (previous == 0) break;
+    uint32_t interval = now - previous;
+    uint32_t count = (interval + best / 2) / best;
+    int32_t offset = (int32_t)interval - (int32_t)(count * best);
+    if (count > 0 && abs(offset) < best / 4) {
+      span += interval;
+      beatsInSpan += count;
+    }
+  }
+  int32_t period = beatsInSpan ? span / beatsInSpan : best;
+  
+  // Glide to small tempo changes, jump to big ones
+  int16_t change = period - beatPeriod;
+  beatPeriod = (abs(change) > 40) ? period : beatPeriod + change / 4;
+}
+
+void lockBeat(unsigned long now) {
+  if (!beatLocked) {
+    if (++onsetsSinceLock < BEAT_LOCK_ONSETS) return;
+    beatLocked = true;
+    nextBeat = now + beatPeriod; // This onset is a beat
+    return;
+  }
+  
+  // Distance to the nearest predicted beat, within half a period
+  int32_t error = (int32_t)(now - (nextBeat - beatPeriod)) % beatPeriod;
+  if (error < 0) error += beatPeriod;
+  if (error > beatPeriod / 2) error -= beatPeriod;
+  beatPhaseError = error;
+  
+  // Onsets between beats (off-beats, fills) don't move the clock
+  if (abs(error) < beatPeriod / 4) nextBeat += error / 4;
+}
+
+// Feed one frame of band levels, true on an onset
+bool detectOnset(const uint8_t *bands, unsigned long now) {
+  uint16_t flux = 0;
+  for (uint8_t i = 0; i < AUDIO_BANDS; i++) {
+    if (bands[i] > prevBands[i]) flux += (bands[i] - prevBands[i]) * (i < 2 ? 2 : 1);
+    prevBands[i] = bands[i];
+  }
+  
+  uint16_t average = fluxSum / ONSET_HISTORY;
+  fluxSum += flux - fluxHistory[fluxIndex];
+  fluxHistory[fluxIndex] = flux;
+  fluxIndex = (fluxIndex + 1) % ONSET_HISTORY;
+  
+  if (flux < ONSET_MIN_FLUX || (uint32_t)flux * 100 <= (uint32_t)average * ONSET_SENSITIVITY ||
+      now - lastOnset < ONSET_REFRACTORY) {
+    return false;
+  }
+  
+  lastOnset = now;
+  onsets++;
+  trackTempo(now);
+  lockBeat(now);
+  return true;
+}
+
+// Advance the beat clock - call once per loop before the effects
+void updateBeatClock() {
+  unsigned long now = millis();
+  
+  if (beatLocked && now - lastOnset > BEAT_LOST_TIMEOUT) {
+    beatLocked = false;
+    onsetsSinceLock = 0;
+  }
+  if (!beatLocked) {
+    beatPhase = 0;
+    return;
+  }
+  
+  while ((long)(now - nextBeat) >= 0) {
+    nextBeat += beatPeriod;
+    beatTick = true;
+    beats++;
+  }
+  beatPhase = 255 - (uint32_t)(nextBeat - now) * 255 / beatPeriod;
+}
+
+// Falls from 255 to 0 over each beat, full while no beat is locked
+uint8_t beatEnvelope() {
+  return beatLocked ? 255 - beatPhase : 255;
+}
+
+// ========== MUSIC TIMELINE ==========
+// tools/make_timeline.py analyses a song on a PC into a timeline: band
+// levels every frameMs plus beat, bar and section marks, uploaded to
+// TIMELINE_FILE with POST /timeline. Started with a song position and a
+// delay (CMD_TIMELINE_PLAY or /timeline?play=), the player reads the frame
+// for the current position from flash and hands it to the music effects in
+// place of live analysis. The show stays exactly on time and costs almost
+// no CPU. Positions run on effectMillis(), so synced lamps agree.
+#define TIMELINE_FILE "/timeline.bin"
+#define TIMELINE_UPLOAD_FILE "/timeline.tmp"
+#define TIMELINE_MAGIC 0x314C544F             // "OTL1"
+#define TIMELINE_FRAME_SIZE (AUDIO_BANDS + 2) // bands, flags, section
+#define TIMELINE_BLOCK_FRAMES 32              // Frames read from flash at once
+#define TIMELINE_FLAG_BEAT 0x01
+#define TIMELINE_FLAG_BAR 0x02
+#define TIMELINE_FLAG_SECTION 0x04
+#define TIMELINE_STOP 0xFFFFFFFF              // Play position that stops playback
+
+struct TimelineHeader {
+  uint32_t magic;
+  uint16_t frameMs;
+  uint16_t beatPeriod;    // ms
+  uint32_t frameCount;
+  char name[48];          // Song file name, matched by the web page
+} __attribute__((packed));
+
+TimelineHeader timelineHeader;
+bool timelineValid = false;
+File timelineFile;
+uint8_t timelineBlock[TIMELINE_BLOCK_FRAMES * TIMELINE_FRAME_SIZE];
+int32_t timelineBlockStart = -1;   // First frame in timelineBlock
+int32_t timelineFrame = -1;        // Frame last handed to the effects
+bool timelinePlaying = false;
+unsigned long timelineStart = 0;   // effectMillis() at song position 0
+uint8_t timelineSection = 0;       // Effects shift their colors per section
+
+// Play requests from the socket and HTTP handlers, started by loop()
+volatile bool timelineRequest = false;
+volatile uint32_t timelineRequestPosition = 0;
+volatile unsigned long timelineRequestAt = 0; // effectMillis() at that position
+
+// Timeline stats
+unsigned long timelineFrames = 0;
+unsigned long timelineReads = 0;       // Block reads from flash
+unsigned long timelineReadMaxMicros = 0;
+
+bool openTimeline() {
+  if (timelineFile) timelineFile.close();
+  timelineValid = false;
+  timelineBlockStart = -1;
+  
+  timelineFile = LittleFS.open(TIMELINE_FILE, "r");
+  if (!timelineFile) return false;
+  if (timelineFile.read((uint8_t *)&timelineHeader, sizeof(timelineHeader)) != sizeof(timelineHeader) ||
+      timelineHeader.magic != TIMELINE_MAGIC || timelineHeader.frameMs == 0 ||
+      timelineHeader.beatPeriod == 0 ||
+      timelineFile.size() != sizeof(timelineHeader) + timelineHeader.frameCount * TIMELINE_FRAME_SIZE) {
+    timelineFile.close();
+    return false;
+  }
+  timelineHeader.name[sizeof(timelineHeader.name) - 1] = 0;
+  timelineValid = true;
+  return true;
+}
+
+void closeTimeline() {
+  timelinePlaying = false;
+  timelineValid = false;
+  if (timelineFile) timelineFile.close();
+}
+
+// Be at song position (ms) after delayMs - safe from the web handlers
+void requestTimeline(uint32_t position, uint32_t delayMs) {
+  timelineRequestPosition = position;
+  timelineRequestAt = effectMillis() + delayMs;
+  timelineRequest = true;
+}
+
+void handleTimeline() {
+  if (!timelineRequest) return;
+  timelineRequest = false;
+  
+  if (timelineRequestPosition == TIMELINE_STOP) {
+    timelinePlaying = false;
+    return;
+  }
+  if (!timelineValid && !openTimeline()) {
+    Serial.println("Timeline: nothing uploaded");
+    return;
+  }
+  
+  timelineStart = timelineRequestAt - timelineRequestPosition;
+  timelineFrame = -1;
+  timelineSection = 0;
+  timelinePlaying = true;
+  if (!musicPlaying) queueCommand(CMD_MUSIC_PLAY, 0);
+}
+
+// Hand the frame for the current song position to the effects - false
+// when it was already shown or the song hasn't reached position 0 yet
+bool takeTimelineFrame() {
+  long position = (long)(effectMillis() - timelineStart);
+  if (position < 0) return false;
+  
+  uint32_t frame = position / timelineHeader.frameMs;
+  if (frame >= timelineHeader.frameCount) {
+    timelinePlaying = false; // Song over - live input takes over again
+    return false;
+  }
+  if ((int32_t)frame == timelineFrame) return false;
+  
+  // Marks of frames skipped since the last render still count
+  uint32_t next = (timelineFrame >= 0 && (uint32_t)timelineFrame < frame) ? timelineFrame + 1 : frame;
+  uint8_t flags = 0;
+  
+  if (timelineBlockStart < 0 || frame < (uint32_t)timelineBlockStart ||
+      frame >= (uint32_t)timelineBlockStart + TIMELINE_BLOCK_FRAMES) {
+    // Skipped frames still in the old block
+    if (timelineBlockStart >= 0 && next >= (uint32_t)timelineBlockStart) {
+      uint32_t end = timelineBlockStart + TIMELINE_BLOCK_FRAMES;
+      for (; next < end && next < frame; next++) {
+        flags |= timelineBlock[(next - timelineBlockStart) * TIMELINE_FRAME_SIZE + AUDIO_BANDS];
+      }
+    }
+    // The rest come with the new block when it can reach back to them
+    uint32_t start = frame - next < TIMELINE_BLOCK_FRAMES ? next : frame;
+    
+    unsigned long begin = micros();
+    timelineFile.seek(sizeof(timelineHeader) + start * TIMELINE_FRAME_SIZE);
+    timelineFile.read(timelineBlock, sizeof(timelineBlock)); // Short at the end of the file
+    timelineBlockStart = start;
+    timelineReads++;
+    unsigned long took = micros() - begin;
+    if (took > timelineReadMaxMicros) timelineReadMaxMicros = took;
+  }
+  
+  if (next < (uint32_t)timelineBlockStart) next = timelineBlockStart;
+  for (; next <= frame; next++) {
+    flags |= timelineBlock[(next - timelineBlockStart) * TIMELINE_FRAME_SIZE + AUDIO_BANDS];
+  }
+  
+  const uint8_t *data = timelineBlock + (frame - timelineBlockStart) * TIMELINE_FRAME_SIZE;
+  memcpy(audioLevels, data, AUDIO_BANDS);
+  timelineSection = data[AUDIO_BANDS + 1];
+  audioOnset = flags & TIMELINE_FLAG_BEAT;
+  
+  // The timeline knows where the beats are - set the beat clock to them
+  if (audioOnset) {
+    beatPeriod = timelineHeader.beatPeriod;
+    beatLocked = true;
+    lastOnset = millis();
+    nextBeat = lastOnset; // Ticks on this loop
+    onsets++;
+  }
+  
+  audioLive = true;
+  audioBassOnly = false;
+  lastAudioFrame = millis();
+  timelineFrame = frame;
+  timelineFrames++;
+  return true;
+}
+
+// ========== MICROPHONE INPUT ==========
+// An analog microphone module on A0 lets the music effects follow room
+// sound without a phone. While music mode runs, loop() reads A0 every
+// MIC_SAMPLE_PERIOD us. The ADC can't be read any faster without WiFi
+// dropping out, so the lamp only hears the bass: FFT_SIZE samples are
+// analysed every MIC_HOP new ones with a fixed-point FFT, reduced to the
+// same AUDIO_BANDS levels the page streams, with automatic gain control.
+// Frames from the page take priority, and a quiet room (or no microphone)
+// sends nothing so the effects keep animating on their own.
+#define MIC_SAMPLE_RATE 256     // Hz - bins are 8 Hz apart, top band ends at 128 Hz
+#define MIC_TOP_HZ (MIC_SAMPLE_RATE / 2) // Highest sound the microphone path hears
+#define MIC_SAMPLE_PERIOD (1000000UL / MIC_SAMPLE_RATE) // us between A0 reads
+#define FFT_SIZE 32             // Samples per analysis frame (125 ms)
+#define FFT_STAGES 5            // log2(FFT_SIZE)
+#define MIC_HOP 8               // New samples per analysis frame (31 ms, frames overlap by 3/4)
+#define MIC_NOISE_FLOOR 24      // Loudest band below this counts as silence
+#define MIC_AGC_DECAY 128       // Gain recovers by 1/MIC_AGC_DECAY of the peak per frame
+
+int16_t micSamples[FFT_SIZE];          // Oldest first
+uint8_t micCount = 0;                  // Samples in micSamples
+unsigned long micNextSample = 0;       // micros() of the next A0 read
+bool micRunning = false;
+volatile bool micPaused = false;       // Set while a web handler writes to flash
+
+// FFT work buffers and Q15 tables
+int16_t fftRe[FFT_SIZE];
+int16_t fftIm[FFT_SIZE];
+int16_t fftCos[FFT_SIZE / 2];
+int16_t fftSin[FFT_SIZE / 2];
+int16_t fftWindow[FFT_SIZE];
+const uint8_t micBandEdges[AUDIO_BANDS + 1] = {1, 2, 3, 4, 5, 6, 8, 11, 16}; // FFT bins
+
+uint16_t micAgcPeak = MIC_NOISE_FLOOR;
+uint8_t micSeq = 0;
+unsigned long lastSocketAudio = 0;     // Page frames win over the microphone
+
+// Microphone stats
+unsigned long micFrames = 0;
+unsigned long micLateSamples = 0;      // Reads a whole period late because loop() stalled
+uint32_t micAnalysisCycles = 0;        // Last analysis frame
+uint32_t micAnalysisMaxCycles = 0;
+uint32_t micReadMaxCycles = 0;         // Longest analogRead()
+
+void initFft() {
+  for (uint16_t i = 0; i < FFT_SIZE / 2; i++) {
+    fftCos[i] = (int16_t)(cos(TWO_PI * i / FFT_SIZE) * 32767);
+    fftSin[i] = (int16_t)(-sin(TWO_PI * i / FFT_SIZE) * 32767);
+  }
+  for (uint16_t i = 0; i < FFT_SIZE; i++) {
+    fftWindow[i] = (int16_t)((0.5 - 0.5 * cos(TWO_PI * i / (FFT_SIZE - 1))) * 32767); // Hann
+  }
+}
+
+// In-place radix-2 FFT on Q15 data. Every stage halves the values, so
+// nothing can overflow and the result is the spectrum divided by FFT_SIZE.
+void fixedFft(int16_t *re, int16_t *im) {
+  for (uint16_t i = 1, j = 0; i < FFT_SIZE; i++) {
+    uint16_t bit = FFT_SIZE >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+  
+  for (uint16_t len = 2; len <= FFT_SIZE; len <<= 1) {
+    uint16_t half = len >> 1;
+    uint16_t step = FFT_SIZE / len;
+    for (uint16_t i = 0; i < FFT_SIZE; i += len) {
+      for (uint16_t k = 0; k < half; k++) {
+        int32_t wr = fftCos[k * step];
+        int32_t wi = fftSin[k * step];
+        uint16_t a = i + k;
+        uint16_t b = a + half;
+        int32_t tr = (wr * re[b] - wi * im[b]) >> 15;
+        int32_t ti = (wr * im[b] + wi * re[b]) >> 15;
+        int32_t ur = re[a];
+        int32_t ui = im[a];
+        re[a] = (ur + tr) >> 1;
+        im[a] = (ui + ti) >> 1;
+        re[b] = (ur - tr) >> 1;
+        im[b] = (ui - ti) >> 1;
+      }
+    }
+  }
+}
+
+void startMicSampler() {
+  if (micRunning) return;
+  micCount = 0;
+  micNextSample = micros();
+  micRunning = true;
+}
+
+// Also used around flash writes - the loop stalls meanwhile, so the next
+// frame starts over instead of analysing across the gap
+void stopMicSampler() {
+  micRunning = false;
+}
+
+// Turn one buffer of samples into band levels and queue them as an audio frame
+void analyseMicFrame(const int16_t *samples) {
+  uint32_t start = ESP.getCycleCount();
+  
+  // Remove the DC bias, scale up to use the Q15 range and apply the window
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < FFT_SIZE; i++) sum += samples[i];
+  int16_t bias = sum / FFT_SIZE;
+  for (uint16_t i = 0; i < FFT_SIZE; i++) {
+    fftRe[i] = ((int32_t)((samples[i] - bias) << 5) * fftWindow[i]) >> 15;
+    fftIm[i] = 0;
+  }
+  
+  fixedFft(fftRe, fftIm);
+  
+  // Peak magnitude per band (max + min/2 is close enough to the length)
+  uint16_t raw[AUDIO_BANDS];
+  uint16_t loudest = 0;
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) {
+    uint16_t peak = 0;
+    for (uint8_t bin = micBandEdges[band]; bin < micBandEdges[band + 1]; bin++) {
+      uint16_t re = abs(fftRe[bin]);
+      uint16_t im = abs(fftIm[bin]);
+      uint16_t magnitude = (re > im) ? re + im / 2 : im + re / 2;
+      if (magnitude > peak) peak = magnitude;
+    }
+    raw[band] = peak;
+    if (peak > loudest) loudest = peak;
+  }
+  
+  // Automatic gain: follow the loudest band up at once, back down slowly
+  micAgcPeak -= micAgcPeak / MIC_AGC_DECAY;
+  if (loudest > micAgcPeak) micAgcPeak = loudest;
+  if (micAgcPeak < MIC_NOISE_FLOOR) micAgcPeak = MIC_NOISE_FLOOR;
+  
+  micAnalysisCycles = ESP.getCycleCount() - start;
+  if (micAnalysisCycles > micAnalysisMaxCycles) micAnalysisMaxCycles = micAnalysisCycles;
+  micFrames++;
+  
+  if (loudest < MIC_NOISE_FLOOR) return; // Silence - let the effects run on their own
+  
+  uint8_t payload[AUDIO_FRAME_SIZE];
+  uint16_t sent = millis();
+  payload[0] = micSeq++;
+  payload[1] = 0;
+  payload[2] = sent >> 8;
+  payload[3] = sent & 0xFF;
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) {
+    uint32_t level = (uint32_t)raw[band] * 255 / micAgcPeak;
+    payload[4 + band] = level > 255 ? 255 : level;
+  }
+  
+  pushAudioFrame(payload, AUDIO_SOURCE_MIC);
+}
+
+void handleMicrophone() {
+  // Sample only while music mode runs
+  bool wanted = musicPlaying && !micPaused;
+  if (wanted != micRunning) {
+    if (wanted) startMicSampler();
+    else stopMicSampler();
+  }
+  if (!micRunning) return;
+  
+  unsigned long now = micros();
+  if ((long)(now - micNextSample) < 0) return;
+  if (now - micNextSample >= MIC_SAMPLE_PERIOD) {
+    micLateSamples++;
+    micNextSample = now; // Carry on from here rather than read in a burst
+  }
+  micNextSample += MIC_SAMPLE_PERIOD;
+  
+  uint32_t start = ESP.getCycleCount();
+  micSamples[micCount++] = analogRead(A0);
+  uint32_t cycles = ESP.getCycleCount() - start;
+  if (cycles > micReadMaxCycles) micReadMaxCycles = cycles;
+  if (micCount < FFT_SIZE) return;
+  
+  // The show comes from flash, or the page is streaming
+  if (!timelinePlaying && millis() - lastSocketAudio >= AUDIO_TIMEOUT) {
+    analyseMicFrame(micSamples);
+  }
+  micCount = FFT_SIZE - MIC_HOP;
+  memmove(micSamples, micSamples + MIC_HOP, micCount * sizeof(micSamples[0]));
+}
+
+// ========== STATION MODE ==========
+// With a home network saved in WIFI_CONFIG_FILE the lamp joins it as a
+// normal client, so phones keep their internet while using the lamp. The
+// join first uses the BSSID and channel cached from the last connection,
+// which skips the scan; if that fails a normal join with scan follows.
+// If no join works within STA_JOIN_TIMEOUT the lamp starts its own access
+// point as before. After a router reboot the lamp rejoins the same way and
+// brings its AP back only if the network stays gone for STA_LOST_TIMEOUT.
+// Credentials are set (or cleared with an empty ssid) by POST /wifi.
+#define WIFI_CONFIG_FILE "/wifi.cfg"
+#define WIFI_CONFIG_MAGIC 0x4F574346   // "FCWO"
+#define STA_FAST_JOIN_TIMEOUT 3000     // ms for the join with cached BSSID/channel
+#define STA_JOIN_TIMEOUT 15000         // ms before a boot join falls back to the AP
+#define STA_LOST_TIMEOUT 60000         // ms offline before the AP comes back
+#define STA_RETRY_INTERVAL 5000        // ms between join attempts
+#define STA_AP_RETRY_INTERVAL 30000    // Same while the AP is up (each scan disturbs it)
+
+struct WifiConfig {
+  uint32_t magic;
+  char ssid[33];
+  char password[65];
+  uint8_t bssid[6];
+  uint8_t channel;               // 0 = unknown, scan for the network
+  uint32_t crc;
+} __attribute__((packed));
+
+WifiConfig wifiConfig;
+bool wifiConfigValid = false;
+WifiConfig newWifiConfig;                // Written by POST /wifi
+volatile bool wifiConfigChanged = false; // Applied in loop()
+
+WiFiEventHandler staGotIpHandler;
+WiFiEventHandler staDisconnectedHandler;
+volatile bool staLinkUp = false;
+
+unsigned long staJoinStarted = 0;  // Start of the boot join or of the outage
+unsigned long staLastAttempt = 0;
+bool staFastJoin = false;          // Current attempt uses the cached BSSID
+bool staEverJoined = false;
+bool apRunning = false;
+
+// Station stats
+unsigned long staJoinMillis = 0;       // Boot to IP
+unsigned long staReconnectMillis = 0;  // Last outage, link lost to IP back
+unsigned long staReconnects = 0;
+
+uint32_t checksum32(const uint8_t *data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+bool loadWifiConfig() {
+  File file = LittleFS.open(WIFI_CONFIG_FILE, "r");
+  if (!file) return false;
+  bool complete = file.read((uint8_t *)&wifiConfig, sizeof(wifiConfig)) == sizeof(wifiConfig);
+  file.close();
+  return complete && wifiConfig.magic == WIFI_CONFIG_MAGIC && wifiConfig.ssid[0] &&
+         wifiConfig.crc == checksum32((const uint8_t *)&wifiConfig, offsetof(WifiConfig, crc));
+}
+
+void saveWifiConfig() {
+  wifiConfig.magic = WIFI_CONFIG_MAGIC;
+  wifiConfig.crc = checksum32((const uint8_t *)&wifiConfig, offsetof(WifiConfig, crc));
+  bool sampling = micRunning;
+  stopMicSampler();
+  File file = LittleFS.open(WIFI_CONFIG_FILE, "w");
+  if (file) {
+    file.write((const uint8_t *)&wifiConfig, sizeof(wifiConfig));
+    file.close();
+  } else {
+    Serial.println("WiFi: could not save the network config");
+  }
+  if (sampling) startMicSampler();
+}
+
+// (Re)open the UDP listeners on the current interface - multicast groups
+// are joined per interface address
+void beginUdpListeners() {
+  ddpUdp.stop();
+  e131Udp.stop();
+  syncUdp.stop();
+  ddpUdp.begin(DDP_PORT);
+  e131Udp.beginMulticast(lampIP(), IPAddress(239, 255, 0, E131_UNIVERSE), E131_PORT);
+  syncUdp.beginMulticast(lampIP(), syncGroup, SYNC_PORT);
+}
+
+// Own access point with a static IP and the captive-portal DNS. With
+// keepStation the station side stays up and keeps trying to rejoin.
+void startAccessPoint(bool keepStation) {
+  WiFi.mode(keepStation ? WIFI_AP_STA : WIFI_AP);
+  
+  // Set a static IP to avoid DHCP issues
+  WiFi.softAPConfig(apIP, gateway, subnet);
+  
+  // Set better WiFi parameters
+  wifi_set_phy_mode(PHY_MODE_11N);  // Use 802.11n mode
+  wifi_set_channel(6);  // Set to channel 6 (less crowded)
+  
+  // Start Access Point with stability settings
+  bool apStarted = WiFi.softAP(ssid, password, 6, 0, 4);
+  
+  if (!apStarted) {
+    Serial.println("Failed to start AP! Retrying...");
+    delay(1000);
+    ESP.restart();
+  }
+  apRunning = true;
+  
+  // Captive portal: every DNS name resolves to the lamp
+  dnsServer.setErrorReplyCode(DNSReplyCode::NoError);
+  dnsServer.start(DNS_PORT, "*", apIP);
+  
+  Serial.println("Access Point Started");
+  Serial.print("SSID: ");
+  Serial.println(ssid);
+  Serial.print("IP Address: ");
+  Serial.println(WiFi.softAPIP());
+  Serial.print("MAC Address: ");
+  Serial.println(WiFi.softAPmacAddress());
+}
+
+void stopAccessPoint() {
+  dnsServer.stop();
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_STA);
+  apRunning = false;
+  apStationCount = 0;
+}
+
+// One join attempt - with the cached BSSID and channel when we have them
+void joinNetwork(bool fast) {
+  staFastJoin = fast && wifiConfig.channel != 0;
+  if (staFastJoin) {
+    WiFi.begin(wifiConfig.ssid, wifiConfig.password, wifiConfig.channel, wifiConfig.bssid);
+  } else {
+    WiFi.begin(wifiConfig.ssid, wifiConfig.password);
+  }
+  staLastAttempt = millis();
+}
+
+void startStation() {
+  WiFi.persistent(false);         // Our own config file is the only copy in flash
+  WiFi.setAutoReconnect(false);   // loop() rejoins with the cached BSSID instead
+  WiFi.hostname("optic-rgb");
+  if (!apRunning) WiFi.mode(WIFI_STA);
+  
+  staGotIpHandler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP &) {
+    staLinkUp = true;
+  });
+  staDisconnectedHandler = WiFi.onStationModeDisconnected([](const WiFiEventStationModeDisconnected &) {
+    staLinkUp = false;
+  });
+  
+  wifiState = WIFI_STATE_CONNECTING;
+  staJoinStarted = millis();
+  joinNetwork(true);
+  
+  Serial.print("WiFi: joining ");
+  Serial.println(wifiConfig.ssid);
+}
+
+void onStationJoined() {
+  unsigned long took = millis() - staJoinStarted;
+  if (staEverJoined) {
+    staReconnectMillis = took;
+    staReconnects++;
+  } else {
+    staJoinMillis = took;
+    staEverJoined = true;
+  }
+  wifiState = WIFI_STATE_STATION;
+  
+  // Cache where the network is for the next fast join
+  if (memcmp(wifiConfig.bssid, WiFi.BSSID(), 6) != 0 || wifiConfig.channel != WiFi.channel()) {
+    memcpy(wifiConfig.bssid, WiFi.BSSID(), 6);
+    wifiConfig.channel = WiFi.channel();
+    saveWifiConfig();
+  }
+  
+  if (apRunning) stopAccessPoint();
+  beginUdpListeners();
+  
+  Serial.print("WiFi: joined in ");
+  Serial.print(took);
+  Serial.print(" ms, IP ");
+  Serial.println(WiFi.localIP());
+}
+
+// New credentials from POST /wifi
+void applyWifiConfig() {
+  wifiConfigChanged = false;
+  wifiConfig = newWifiConfig;
+  staEverJoined = false;
+  
+  if (wifiConfig.ssid[0] == 0) {
+    // Forget the home network and go back to the access point
+    LittleFS.remove(WIFI_CONFIG_FILE);
+    wifiConfigValid = false;
+    WiFi.disconnect();
+    wifiState = WIFI_STATE_AP;
+    if (!apRunning) {
+      startAccessPoint(false);
+      beginUdpListeners();
+    }
+    return;
+  }
+  
+  wifiConfigValid = true;
+  saveWifiConfig();
+  startStation();
+}
+
+void maintainStation() {
+  if (wifiConfigChanged) applyWifiConfig();
+  if (!wifiConfigValid) return;
+  
+  unsigned long now = millis();
+  
+  if (wifiState == WIFI_STATE_STATION) {
+    if (!staLinkUp) {
+      // Router gone - rejoin straight away on the cached BSSID/channel
+      Serial.println("WiFi: network lost, rejoining");
+      wifiState = WIFI_STATE_CONNECTING;
+      staJoinStarted = now;
+      joinNetwork(true);
+    }
+    return;
+  }
+  
+  if (wifiState != WIFI_STATE_CONNECTING) return;
+  
+  if (staLinkUp) {
+    onStationJoined();
+    return;
+  }
+  
+  // The cached BSSID did not answer - scan for the network
+  if (staFastJoin && now - staLastAttempt > STA_FAST_JOIN_TIMEOUT) {
+    joinNetwork(false);
+    return;
+  }
+  
+  if (!apRunning) {
+    if (now - staJoinStarted > (staEverJoined ? STA_LOST_TIMEOUT : STA_JOIN_TIMEOUT)) {
+      if (staEverJoined) {
+        // Keep trying in the background, reachable on the AP meanwhile
+        Serial.println("WiFi: network still gone - starting the access point");
+        startAccessPoint(true);
+      } else {
+        Serial.println("WiFi: join failed - starting the access point");
+        WiFi.disconnect();
+        wifiState = WIFI_STATE_AP;
+        startAccessPoint(false);
+      }
+      beginUdpListeners();
+      return;
+    }
+  }
+  
+  if (now - staLastAttempt > (apRunning ? STA_AP_RETRY_INTERVAL : STA_RETRY_INTERVAL)) {
+    joinNetwork(true);
+  }
+}
+
+// ========== TOUCH SENSOR FUNCTIONS ==========
+// An interrupt on every edge of the sensor pin puts the time and level in
+// touchEdges, a ring only the interrupt writes the head of and only loop()
+// the tail of, so neither side needs a lock. loop() debounces the edges
+// (an edge within TOUCH_DEBOUNCE_TIME of the last accepted one is bounce,
+// and then the pin is read once that time is over) and runs the press state
+// machine on their timestamps, so a slow frame does not stretch a press.
+// Taps within TOUCH_TAP_WINDOW of each other make a double or triple tap;
+// a tap is decided as soon as no longer gesture could follow, so with
+// double and triple tap unmapped it acts on release. What each gesture
+// does is in TOUCH GESTURES. Feedback blinks are an overlay in
+// strip.show() - nothing waits.
+enum TouchState : uint8_t {
+  TOUCH_IDLE,
+  TOUCH_PRESSED,
+  TOUCH_HOLDING,        // Past TOUCH_HOLD_TIME, until the release
+  TOUCH_IGNORED         // Held since boot, waiting for the release
+};
+
+enum TouchGesture : uint8_t {
+  GESTURE_TAP,          // Taps counted in order: one, two, three
+  GESTURE_DOUBLE_TAP,
+  GESTURE_TRIPLE_TAP,
+  GESTURE_HOLD,
+  TOUCH_GESTURES
+};
+
+volatile uint32_t touchEdgeMicros[TOUCH_QUEUE_SIZE];
+volatile bool touchEdgePressed[TOUCH_QUEUE_SIZE];
+volatile uint8_t touchHead = 0;      // Written by touchIsr() only
+volatile uint8_t touchTail = 0;      // Written by loop() only
+volatile bool touchResync = false;   // An edge was dropped - read the pin again
+
+uint8_t touchState = TOUCH_IDLE;
+bool touchDown = false;              // Debounced level
+unsigned long touchLastEdge = 0;     // micros() of the last accepted edge
+unsigned long touchPressMicros = 0;
+uint8_t touchTaps = 0;               // Taps waiting for the window to close
+unsigned long touchLastRelease = 0;
+unsigned long feedbackPhase = 0;
+
+// Touch stats
+unsigned long touchPresses = 0;
+unsigned long touchBounces = 0;      // Edges dropped by the debounce
+volatile unsigned long touchDropped = 0; // Edges lost to a full queue
+unsigned long touchLatencyMicros = 0; // Edge to the LEDs showing the response
+unsigned long touchLatencyMaxMicros = 0;
+
+void ICACHE_RAM_ATTR touchIsr() {
+  uint8_t head = touchHead;
+  uint8_t next = (head + 1) & (TOUCH_QUEUE_SIZE - 1);
+  if (next == touchTail) {
+    touchDropped++;
+    touchResync = true;
+    return;
+  }
+  touchEdgeMicros[head] = micros();
+  touchEdgePressed[head] = digitalRead(TOUCH_SENSOR_PIN) == LOW; // Active LOW
+  touchHead = next;
+}
+
+void startTouchInput() {
+  // Still held from the boot self-test - that press does nothing
+  touchDown = digitalRead(TOUCH_SENSOR_PIN) == LOW;
+  touchState = touchDown ? TOUCH_IGNORED : TOUCH_IDLE;
+  touchLastEdge = micros();
+  attachInterrupt(digitalPinToInterrupt(TOUCH_SENSOR_PIN), touchIsr, CHANGE);
+}
+
+void startTouchFeedback(uint8_t blinks) {
+  feedbackLevel = currentBrightness;
+  feedbackStart = millis();
+  feedbackPhase = 0;
+  feedbackBlinks = blinks;
+}
+
+// The response just went out to the LEDs; edgeMicros is when it was due
+void recordTouchLatency(unsigned long edgeMicros) {
+  touchLatencyMicros = micros() - edgeMicros;
+  if (touchLatencyMicros > touchLatencyMaxMicros) touchLatencyMaxMicros = touchLatencyMicros;
+  touchPresses++;
+}
+
+// The taps so far make one gesture
+void finishTaps(unsigned long dueMicros) {
+  uint8_t gesture = GESTURE_TAP + touchTaps - 1;
+  touchTaps = 0;
+  runTouchGesture(gesture, dueMicros);
+}
+
+void touchTap(unsigned long releaseMicros) {
+  touchTaps++;
+  touchLastRelease = releaseMicros;
+  
+  // No point waiting for more taps when nothing longer is mapped
+  bool longer = false;
+  for (uint8_t gesture = GESTURE_TAP + touchTaps; gesture < GESTURE_HOLD; gesture++) {
+    longer |= touchGestureUsed(gesture);
+  }
+  if (!longer) finishTaps(releaseMicros);
+}
+
+void touchEdge(bool pressed, unsigned long edgeMicros) {
+  if (pressed == touchDown) return;
+  if (edgeMicros - touchLastEdge < TOUCH_DEBOUNCE_TIME * 1000UL) {
+    touchBounces++;
+    touchResync = true;
+    return;
+  }
+  touchDown = pressed;
+  touchLastEdge = edgeMicros;
+  
+  if (pressed) {
+    // Queued edges can be older than the last pass - the window closed before this press
+    if (touchTaps && edgeMicros - touchLastRelease >= TOUCH_TAP_WINDOW * 1000UL) {
+      finishTaps(touchLastRelease + TOUCH_TAP_WINDOW * 1000UL);
+    }
+    if (touchState == TOUCH_IDLE) {
+      touchState = TOUCH_PRESSED;
+      touchPressMicros = edgeMicros;
+      Serial.println("Touch pressed");
+    }
+    return;
+  }
+  
+  if (touchState == TOUCH_PRESSED) {
+    if (edgeMicros - touchPressMicros >= TOUCH_MIN_PRESS * 1000UL) touchTap(edgeMicros);
+    else touchBounces++;
+  } else if (touchState == TOUCH_HOLDING) {
+    touchHoldEnd();
+  }
+  touchState = TOUCH_IDLE;
+}
+
+void handleTouchSensor() {
+  // Edges queued by the interrupt since the last pass, oldest first
+  while (touchTail != touchHead) {
+    uint8_t tail = touchTail;
+    touchEdge(touchEdgePressed[tail], touchEdgeMicros[tail]);
+    touchTail = (tail + 1) & (TOUCH_QUEUE_SIZE - 1);
+  }
+  
+  // A dropped bounce may have been the last edge - once the lockout is
+  // over the pin tells where the finger really is
+  unsigned long nowMicros = micros();
+  if (touchResync && nowMicros - touchLastEdge >= TOUCH_DEBOUNCE_TIME * 1000UL) {
+    touchResync = false;
+    touchEdge(digitalRead(TOUCH_SENSOR_PIN) == LOW, nowMicros);
+  }
+  
+  // The tap window closed without another tap
+  if (touchState == TOUCH_IDLE && touchTaps &&
+      nowMicros - touchLastRelease >= TOUCH_TAP_WINDOW * 1000UL) {
+    finishTaps(touchLastRelease + TOUCH_TAP_WINDOW * 1000UL);
+  }
+  
+  // A press held long enough is a hold, whatever taps came before it
+  if (touchState == TOUCH_PRESSED && nowMicros - touchPressMicros >= TOUCH_HOLD_TIME * 1000UL) {
+    touchState = TOUCH_HOLDING;
+    touchTaps = 0;
+    touchHoldStart(touchPressMicros + TOUCH_HOLD_TIME * 1000UL);
+  }
+  if (touchState == TOUCH_HOLDING) touchHoldUpdate();
+  
+  // Step the feedback blinks; the last show puts the drawn pixels back
+  if (feedbackBlinks) {
+    unsigned long elapsed = millis() - feedbackStart;
+    unsigned long phase = elapsed / TOUCH_FEEDBACK_BLINK;
+    if (phase >= feedbackBlinks * 2UL - 1) {
+      feedbackBlinks = 0;
+      strip.show();
+    } else if (phase != feedbackPhase) {
+      feedbackPhase = phase;
+      strip.show();
+    }
+  }
+}
+
+// ========== APPLY PENDING COMMANDS ==========
+// Runs in loop() - the only place web requests change the LEDs.
+// Returns true when the LEDs need a refresh.
+bool applyCommand(const ControlCommand &cmd) {
+  switch (cmd.type) {
+    case CMD_COLOR:
+      {
+        int r = (cmd.value >> 16) & 0xFF;
+        int g = (cmd.value >> 8) & 0xFF;
+        int b = cmd.value & 0xFF;
+        
+        currentColor = strip.Color(r, g, b);
+        
+        // Stop any running effect
+        isEffectRunning = false;
+        touchMode = false; // Switch back to web control mode
+        
+        // Set all LEDs to the selected color
+        for (int i = 0; i < NUM_LEDS; i++) {
+          strip.setPixelColor(i, currentColor);
+        }
+        strip.setBrightness(currentBrightness);
+        
+        Serial.print("Color set: R=");
+        Serial.print(r);
+        Serial.print(" G=");
+        Serial.print(g);
+        Serial.print(" B=");
+        Serial.println(b);
+      }
+      return true;
+      
+    case CMD_BRIGHTNESS:
+      currentBrightness = cmd.value;
+      strip.setBrightness(currentBrightness);
+      
+      Serial.print("Brightness set to: ");
+      Serial.println(currentBrightness);
+      return true;
+      
+    case CMD_POWER:
+      if (cmd.value == POWER_KEEP) return false;
+      isPoweredOn = cmd.value == POWER_TOGGLE ? !isPoweredOn : cmd.value != 0;
+      touchMode = false; // Switch back to web control mode
+      
+      if (!isPoweredOn) {
+        // Turn off all LEDs
+        for (int i = 0; i < NUM_LEDS; i++) {
+          strip.setPixelColor(i, 0);
+        }
+        isEffectRunning = false;
+      } else {
+        // Turn on with current color
+        for (int i = 0; i < NUM_LEDS; i++) {
+          strip.setPixelColor(i, currentColor);
+        }
+      }
+      
+      Serial.print("Power toggled: ");
+      Serial.println(isPoweredOn ? "ON" : "OFF");
+      return true;
+      
+    case CMD_EFFECT:
+      currentEffect = cmd.value;
+      isEffectRunning = true;
+      touchMode = false; // Switch back to web control mode
+      effectCounter = 0;
+      effectPosition = 0;
+      hueCounter = 0;
+      
+      Serial.print("Effect started: ");
+      Serial.println(currentEffect);
+      break;
+      
+    case CMD_MUSIC_PLAY:
+      musicPlaying = true;
+      musicEffectCounter = 0;
+      musicEffectPosition = 0;
+      Serial.println("Music playback started");
+      break;
+      
+    case CMD_MUSIC_STOP:
+      musicPlaying = false;
+      timelinePlaying = false;
+      // Clear LEDs when music stops
+      for (int i = 0; i < NUM_LEDS; i++) {
+        strip.setPixelColor(i, 0);
+      }
+      Serial.println("Music playback stopped");
+      return true;
+      
+    case CMD_MUSIC_EFFECT:
+      currentMusicEffect = cmd.value;
+      Serial.print("Music effect changed to: ");
+      Serial.println(currentMusicEffect);
+      break;
+      
+    case CMD_DENSITY:
+      musicDensity = cmd.value;
+      Serial.print("Density set to: ");
+      Serial.println(musicDensity);
+      break;
+      
+    case CMD_ROUGHNESS:
+      musicRoughness = cmd.value;
+      Serial.print("Roughness set to: ");
+      Serial.println(musicRoughness);
+      break;
+      
+    case CMD_EFFECT_SPEED:
+      effectSpeed = cmd.value;
+      Serial.print("Effect speed set to: ");
+      Serial.println(effectSpeed);
+      break;
+      
+    case CMD_GLOWING_SPEED:
+      glowingSpeed = cmd.value;
+      Serial.print("Glowing speed set to: ");
+      Serial.println(glowingSpeed);
+      break;
+  }
+  return false;
+}
+
+void applyPendingCommands() {
+  if (pendingMask == 0) return;
+  
+  uint16_t mask = pendingMask;
+  pendingMask = 0;
+  
+  // Apply in the order the latest values arrived, so e.g. a color picked
+  // after an effect still stops that effect
+  uint8_t order[COMMAND_TYPES];
+  uint8_t count = 0;
+  for (uint8_t type = 0; type < COMMAND_TYPES; type++) {
+    if (!(mask & (1 << type))) continue;
+    uint8_t i = count++;
+    while (i > 0 && (long)(pendingCommands[order[i - 1]].queuedMicros -
+                           pendingCommands[type].queuedMicros) > 0) {
+      order[i] = order[i - 1];
+      i--;
+    }
+    order[i] = type;
+  }
+  
+  bool needsShow = false;
+  unsigned long nowMicros = micros();
+  for (uint8_t i = 0; i < count; i++) {
+    const ControlCommand &cmd = pendingCommands[order[i]];
+    if (applyCommand(cmd)) needsShow = true;
+    recordLatency(nowMicros - cmd.queuedMicros);
+    controlUpdatesApplied++;
+  }
+  
+  // One refresh for everything that arrived since the last frame
+  if (needsShow) strip.show();
+  controlFramesApplied++;
+}
+
+// ========== SAVED STATE ==========
+// The settings survive resets: changes are appended to STATE_LOG_FILE as
+// fixed-size records with a CRC, and the newest intact record is applied
+// at boot before WiFi starts. A save waits until the settings have been
+// still for STATE_SAVE_DELAY ms (a slider drag is one write, not fifty),
+// but never longer than STATE_SAVE_MAX_DELAY. After STATE_LOG_RECORDS
+// records the log is rewritten with just the newest one, into a temporary
+// file that replaces the log in one rename - a reset at any moment leaves
+// an intact record behind.
+#define STATE_LOG_FILE "/state.log"
+#define STATE_LOG_TEMP_FILE "/state.tmp"
+#define STATE_RECORD_MAGIC 0x4C54534F  // "OSTL"
+#define STATE_LOG_RECORDS 64           // Records before the log is compacted
+#define STATE_CHECK_INTERVAL 100       // ms between looks for changes
+#define STATE_SAVE_DELAY 2000          // ms without changes before saving
+#define STATE_SAVE_MAX_DELAY 15000     // ms a change waits at most
+
+struct StateRecord {
+  uint32_t magic;
+  uint32_t sequence;
+  int32_t values[COMMAND_TYPES];       // Indexed like the commands, see readCurrentState()
+  uint32_t crc;
+} __attribute__((packed));
+
+int32_t savedState[COMMAND_TYPES];     // Newest record in the log
+bool savedStateValid = false;
+int32_t seenState[COMMAND_TYPES];      // Settings at the last look
+bool stateDirty = false;
+unsigned long stateChangedAt = 0;      // Last change not yet saved
+unsigned long stateDirtySince = 0;     // First change not yet saved
+uint32_t stateSequence = 0;
+uint16_t stateLogRecords = 0;
+
+// Saved state stats
+unsigned long stateSaves = 0;
+unsigned long stateCompactions = 0;
+unsigned long stateSaveMaxMicros = 0;
+unsigned long stateRestoreMicros = 0;  // Reading the log and applying it at boot
+
+// Settings worth restoring - a song can't carry on after a reset
+void readSavedSettings(int32_t *state) {
+  readCurrentState(state);
+  state[CMD_MUSIC_PLAY] = 0;
+}
+
+// Newest intact record of the log, normally the last one
+bool loadStateLog(StateRecord &record) {
+  File file = LittleFS.open(STATE_LOG_FILE, "r");
+  if (!file) return false;
+  size_t records = file.size() / sizeof(StateRecord);
+  bool damaged = file.size() % sizeof(StateRecord) != 0;
+  bool found = false;
+  for (size_t i = records; i-- > 0 && !found;) {
+    file.seek(i * sizeof(StateRecord));
+    found = file.read((uint8_t *)&record, sizeof(record)) == sizeof(record) &&
+            record.magic == STATE_RECORD_MAGIC &&
+            record.crc == checksum32((const uint8_t *)&record, offsetof(StateRecord, crc));
+    if (!found) damaged = true;
+  }
+  file.close();
+  // Appending behind a torn record would misalign the log - compact instead
+  stateLogRecords = damaged ? STATE_LOG_RECORDS : records;
+  return found;
+}
+
+// Apply settings read with readCurrentState() and show them
+void applyState(const int32_t *state) {
+  // Color first (it stops effects), then the effect, power last (off clears the LEDs)
+  static const uint8_t order[] = {CMD_COLOR, CMD_BRIGHTNESS, CMD_MUSIC_EFFECT, CMD_DENSITY,
+                                  CMD_ROUGHNESS, CMD_EFFECT_SPEED, CMD_GLOWING_SPEED,
+                                  CMD_EFFECT, CMD_POWER};
+  ControlCommand cmd;
+  cmd.queuedMicros = micros();
+  for (uint8_t i = 0; i < sizeof(order); i++) {
+    cmd.type = order[i];
+    cmd.value = state[order[i]];
+    if (cmd.type == CMD_EFFECT && cmd.value == NO_EFFECT) continue;
+    applyCommand(cmd);
+  }
+  strip.show();
+}
+
+void restoreSavedState() {
+  unsigned long start = micros();
+  StateRecord record;
+  if (loadStateLog(record)) {
+    stateSequence = record.sequence;
+    memcpy(savedState, record.values, sizeof(savedState));
+    savedStateValid = true;
+    applyState(savedState);
+  }
+  readSavedSettings(seenState);
+  stateRestoreMicros = micros() - start;
+  
+  Serial.print("State: ");
+  Serial.print(savedStateValid ? "restored record " : "nothing saved, defaults");
+  if (savedStateValid) Serial.print(stateSequence);
+  Serial.print(" in ");
+  Serial.print(stateRestoreMicros);
+  Serial.println(" us");
+}
+
+bool writeStateRecord(const int32_t *state) {
+  unsigned long start = micros();
+  StateRecord record;
+  record.magic = STATE_RECORD_MAGIC;
+  record.sequence = stateSequence + 1;
+  memcpy(record.values, state, sizeof(record.values));
+  record.crc = checksum32((const uint8_t *)&record, offsetof(StateRecord, crc));
+  
+  bool sampling = micRunning;
+  stopMicSampler();
+  bool compact = stateLogRecords >= STATE_LOG_RECORDS;
+  File file = LittleFS.open(compact ? STATE_LOG_TEMP_FILE : STATE_LOG_FILE, compact ? "w" : "a");
+  bool written = file && file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+  if (file) file.close();
+  // Rename replaces the old log in one step
+  if (written && compact) written = LittleFS.rename(STATE_LOG_TEMP_FILE, STATE_LOG_FILE);
+  if (sampling) startMicSampler();
+  
+  if (!written) {
+    Serial.println("State: could not save the settings");
+    return false;
+  }
+  stateSequence = record.sequence;
+  memcpy(savedState, state, sizeof(savedState));
+  savedStateValid = true;
+  if (compact) {
+    stateLogRecords = 1;
+    stateCompactions++;
+  } else {
+    stateLogRecords++;
+  }
+  stateSaves++;
+  unsigned long elapsed = micros() - start;
+  if (elapsed > stateSaveMaxMicros) stateSaveMaxMicros = elapsed;
+  return true;
+}
+
+void saveStateNow() {
+  stateDirty = false;
+  int32_t state[COMMAND_TYPES];
+  readSavedSettings(state);
+  if (savedStateValid && memcmp(state, savedState, sizeof(state)) == 0) return; // Changed back
+  writeStateRecord(state);
+}
+
+// Runs in loop(): save the settings once they have settled
+void maintainSavedState() {
+  static unsigned long lastCheck = 0;
+  unsigned long now = millis();
+  if (now - lastCheck < STATE_CHECK_INTERVAL) return;
+  lastCheck = now;
+  
+  int32_t state[COMMAND_TYPES];
+  readSavedSettings(state);
+  if (memcmp(state, seenState, sizeof(state)) != 0) {
+    memcpy(seenState, state, sizeof(state));
+    if (!stateDirty) stateDirtySince = now;
+    stateDirty = true;
+    stateChangedAt = now;
+  }
+  if (!stateDirty) return;
+  if (now - stateChangedAt < STATE_SAVE_DELAY && now - stateDirtySince < STATE_SAVE_MAX_DELAY) return;
+  saveStateNow();
+}
+
+// Before a deliberate reset - a change still waiting would be lost
+void flushSavedState() {
+  if (stateDirty) saveStateNow();
+}
+
+// ========== PRESETS ==========
+// PRESET_SLOTS favorite scenes in PRESET_FILE, one fixed-size record per
+// slot, so a recall is one seek and one read of PRESET_RECORD bytes from a
+// file kept open since boot - nothing is allocated. Save and recall
+// requests from /preset are carried out by loop(), and a recall applies
+// every setting in the same frame.
+#define PRESET_FILE "/presets.bin"
+#define PRESET_SLOTS 32
+#define PRESET_NAME_SIZE 16
+#define PRESET_MAGIC 0x5453504F  // "OPST"
+#define NO_PRESET -1
+
+struct PresetRecord {
+  uint32_t magic;
+  uint8_t color[3];
+  uint8_t brightness;
+  uint8_t power;
+  uint8_t effect;                // NO_EFFECT for a solid color
+  uint8_t musicEffect;
+  uint8_t density;
+  uint8_t roughness;
+  uint8_t effectSpeed;
+  uint8_t glowingSpeed;
+  char name[PRESET_NAME_SIZE];
+  uint32_t crc;
+} __attribute__((packed));
+
+File presetFile;
+uint32_t presetUsed = 0;         // Bit per slot holding a valid record
+volatile int8_t presetRecallSlot = NO_PRESET; // Set by /preset, run in loop()
+volatile int8_t presetSaveSlot = NO_PRESET;
+volatile int8_t presetDeleteSlot = NO_PRESET;
+char presetSaveName[PRESET_NAME_SIZE];
+
+// Preset stats
+unsigned long presetSaves = 0;
+unsigned long presetRecalls = 0;
+unsigned long presetRecallMaxMicros = 0; // Flash read plus apply
+
+bool readPreset(uint8_t slot, PresetRecord &record) {
+  return presetFile && presetFile.seek(slot * sizeof(PresetRecord)) &&
+         presetFile.read((uint8_t *)&record, sizeof(record)) == sizeof(record) &&
+         record.magic == PRESET_MAGIC &&
+         record.crc == checksum32((const uint8_t *)&record, offsetof(PresetRecord, crc));
+}
+
+bool writePreset(uint8_t slot, const PresetRecord &record) {
+  bool sampling = micRunning;
+  stopMicSampler();
+  bool written = presetFile && presetFile.seek(slot * sizeof(PresetRecord)) &&
+                 presetFile.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+  if (presetFile) presetFile.flush();
+  if (sampling) startMicSampler();
+  return written;
+}
+
+// Open the store (creating empty slots the first time) and note which are used
+void initPresets() {
+  if (!LittleFS.exists(PRESET_FILE)) {
+    File file = LittleFS.open(PRESET_FILE, "w");
+    PresetRecord empty;
+    memset(&empty, 0, sizeof(empty));
+    for (uint8_t slot = 0; file && slot < PRESET_SLOTS; slot++) {
+      file.write((const uint8_t *)&empty, sizeof(empty));
+    }
+    if (file) file.close();
+  }
+  presetFile = LittleFS.open(PRESET_FILE, "r+");
+  
+  PresetRecord record;
+  for (uint8_t slot = 0; slot < PRESET_SLOTS; slot++) {
+    if (readPreset(slot, record)) presetUsed |= 1UL << slot;
+  }
+}
+
+void savePreset(uint8_t slot, const char *name) {
+  int32_t state[COMMAND_TYPES];
+  readSavedSettings(state);
+  
+  PresetRecord record;
+  record.magic = PRESET_MAGIC;
+  record.color[0] = (state[CMD_COLOR] >> 16) & 0xFF;
+  record.color[1] = (state[CMD_COLOR] >> 8) & 0xFF;
+  record.color[2] = state[CMD_COLOR] & 0xFF;
+  record.brightness = state[CMD_BRIGHTNESS];
+  record.power = state[CMD_POWER];
+  record.effect = state[CMD_EFFECT];
+  record.musicEffect = state[CMD_MUSIC_EFFECT];
+  record.density = state[CMD_DENSITY];
+  record.roughness = state[CMD_ROUGHNESS];
+  record.effectSpeed = state[CMD_EFFECT_SPEED];
+  record.glowingSpeed = state[CMD_GLOWING_SPEED];
+  strncpy(record.name, name, PRESET_NAME_SIZE); // Not terminated when full
+  record.crc = checksum32((const uint8_t *)&record, offsetof(PresetRecord, crc));
+  
+  if (!writePreset(slot, record)) {
+    Serial.println("Preset: could not save");
+    return;
+  }
+  presetUsed |= 1UL << slot;
+  presetSaves++;
+  Serial.print("Preset saved to slot ");
+  Serial.println(slot);
+}
+
+// The playlist leaves the power alone - a preset saved with the lamp off
+// would switch it off and stall the playlist, which waits while it is off
+void recallPreset(uint8_t slot, bool withPower) {
+  unsigned long start = micros();
+  PresetRecord record;
+  if (!readPreset(slot, record)) {
+    presetUsed &= ~(1UL << slot);
+    return;
+  }
+  
+  int32_t state[COMMAND_TYPES];
+  readCurrentState(state);
+  state[CMD_COLOR] = ((int32_t)record.color[0] << 16) | ((int32_t)record.color[1] << 8) | record.color[2];
+  state[CMD_BRIGHTNESS] = record.brightness;
+  if (withPower) state[CMD_POWER] = record.power;
+  state[CMD_EFFECT] = record.effect;
+  state[CMD_MUSIC_EFFECT] = record.musicEffect;
+  state[CMD_DENSITY] = record.density;
+  state[CMD_ROUGHNESS] = record.roughness;
+  state[CMD_EFFECT_SPEED] = record.effectSpeed;
+  state[CMD_GLOWING_SPEED] = record.glowingSpeed;
+  applyState(state);
+  
+  presetRecalls++;
+  unsigned long elapsed = micros() - start;
+  if (elapsed > presetRecallMaxMicros) presetRecallMaxMicros = elapsed;
+}
+
+void deletePreset(uint8_t slot) {
+  PresetRecord empty;
+  memset(&empty, 0, sizeof(empty));
+  if (writePreset(slot, empty)) presetUsed &= ~(1UL << slot);
+}
+
+// Runs in loop(): carry out the latest /preset request
+void handlePresets() {
+  if (presetSaveSlot != NO_PRESET) {
+    uint8_t slot = presetSaveSlot;
+    presetSaveSlot = NO_PRESET;
+    savePreset(slot, presetSaveName);
+  }
+  if (presetDeleteSlot != NO_PRESET) {
+    uint8_t slot = presetDeleteSlot;
+    presetDeleteSlot = NO_PRESET;
+    deletePreset(slot);
+  }
+  if (presetRecallSlot != NO_PRESET) {
+    uint8_t slot = presetRecallSlot;
+    presetRecallSlot = NO_PRESET;
+    recallPreset(slot, true);
+  }
+}
+
+// ========== PLAYLIST ==========
+// Steps through a list of effects and presets, each shown for its own
+// number of seconds, in order or shuffled, with an optional crossfade.
+// loop() checks the clock once per pass, so nothing blocks. The list is
+// kept in PLAYLIST_FILE and the position in PLAYLIST_POSITION_FILE
+// (rewritten on every step, entries last PLAYLIST_MIN_SECONDS at least),
+// so after a reboot the same entry comes back. A color or effect picked
+// by hand ends the playlist; it waits while music plays or the lamp is off.
+#define PLAYLIST_FILE "/playlist.bin"
+#define PLAYLIST_POSITION_FILE "/playlist.pos"
+#define PLAYLIST_MAGIC 0x4C50504F    // "OPPL"
+#define PLAYLIST_MAX_ENTRIES 32
+#define PLAYLIST_MIN_SECONDS 5
+#define PLAYLIST_MAX_FADE 10000      // ms
+#define PLAYLIST_FLAG_SHUFFLE 0x01
+
+enum PlaylistKind : uint8_t { PLAYLIST_EFFECT, PLAYLIST_PRESET };
+
+struct PlaylistEntry {
+  uint8_t kind;
+  uint8_t index;                     // Effect 0-99 or preset slot
+  uint16_t seconds;
+} __attribute__((packed));
+
+struct Playlist {
+  uint32_t magic;
+  uint8_t count;
+  uint8_t flags;
+  uint16_t fadeMillis;
+  PlaylistEntry entries[PLAYLIST_MAX_ENTRIES];
+  uint32_t crc;                      // Over the used entries, written after them
+} __attribute__((packed));
+
+struct PlaylistPosition {
+  uint32_t magic;
+  uint8_t active;
+  uint8_t step;
+  uint16_t seed;                     // Shuffle order of the current pass
+  uint32_t crc;
+} __attribute__((packed));
+
+enum PlaylistCommand : uint8_t { PLAYLIST_NONE, PLAYLIST_START, PLAYLIST_STOP, PLAYLIST_NEXT };
+
+Playlist playlist;
+uint8_t playlistOrder[PLAYLIST_MAX_ENTRIES];
+bool playlistActive = false;
+uint8_t playlistStep = 0;            // Position in playlistOrder
+uint16_t playlistSeed = 0;
+unsigned long playlistEntryStart = 0;
+int32_t playlistShownColor = 0;      // What the playlist put up, to notice
+int32_t playlistShownEffect = 0;     // a hand-picked color or effect
+Playlist newPlaylist;                // Written by /playlist?set=
+volatile bool playlistChanged = false;
+volatile uint8_t playlistCommand = PLAYLIST_NONE;
+
+// Playlist stats
+unsigned long playlistSteps = 0;
+
+// Bytes of a playlist with its entries and the crc right behind them
+size_t playlistSize(uint8_t count) {
+  return offsetof(Playlist, entries) + count * sizeof(PlaylistEntry) + sizeof(uint32_t);
+}
+
+uint32_t playlistChecksum(const Playlist &list) {
+  return checksum32((const uint8_t *)&list, offsetof(Playlist, entries) + list.count * sizeof(PlaylistEntry));
+}
+
+// Same seed, same order - a reboot carries on with the same pass
+void shufflePlaylist() {
+  for (uint8_t i = 0; i < playlist.count; i++) playlistOrder[i] = i;
+  if (!(playlist.flags & PLAYLIST_FLAG_SHUFFLE) || playlist.count < 2) return;
+  uint32_t random = playlistSeed * 2654435761UL + 1;
+  for (uint8_t i = playlist.count - 1; i > 0; i--) {
+    random = random * 1664525UL + 1013904223UL;
+    uint8_t j = (random >> 16) % (i + 1);
+    uint8_t swap = playlistOrder[i];
+    playlistOrder[i] = playlistOrder[j];
+    playlistOrder[j] = swap;
+  }
+}
+
+void savePlaylistPosition() {
+  PlaylistPosition position;
+  position.magic = PLAYLIST_MAGIC;
+  position.active = playlistActive;
+  position.step = playlistStep;
+  position.seed = playlistSeed;
+  position.crc = checksum32((const uint8_t *)&position, offsetof(PlaylistPosition, crc));
+  
+  bool sampling = micRunning;
+  stopMicSampler();
+  File file = LittleFS.open(PLAYLIST_POSITION_FILE, "w");
+  if (file) {
+    file.write((const uint8_t *)&position, sizeof(position));
+    file.close();
+  }
+  if (sampling) startMicSampler();
+}
+
+void savePlaylist() {
+  // The crc goes right behind the last entry
+  uint8_t *end = (uint8_t *)&playlist + playlistSize(playlist.count) - sizeof(uint32_t);
+  uint32_t crc = playlistChecksum(playlist);
+  memcpy(end, &crc, sizeof(crc));
+  
+  bool sampling = micRunning;
+  stopMicSampler();
+  File file = LittleFS.open(PLAYLIST_FILE, "w");
+  if (file) {
+    file.write((const uint8_t *)&playlist, playlistSize(playlist.count));
+    file.close();
+  } else {
+    Serial.println("Playlist: could not save");
+  }
+  if (sampling) startMicSampler();
+}
+
+void playPlaylistEntry(bool fade) {
+  const PlaylistEntry &entry = playlist.entries[playlistOrder[playlistStep]];
+  if (fade && playlist.fadeMillis) startTransition(playlist.fadeMillis);
+  
+  if (entry.kind == PLAYLIST_PRESET) {
+    recallPreset(entry.index, false);
+  } else {
+    ControlCommand cmd;
+    cmd.type = CMD_EFFECT;
+    cmd.value = entry.index;
+    cmd.queuedMicros = micros();
+    applyCommand(cmd);
+  }
+  
+  int32_t state[COMMAND_TYPES];
+  readCurrentState(state);
+  playlistShownColor = state[CMD_COLOR];
+  playlistShownEffect = state[CMD_EFFECT];
+  playlistEntryStart = millis();
+  savePlaylistPosition();
+}
+
+void startPlaylist() {
+  if (playlist.count == 0) return;
+  playlistActive = true;
+  playlistStep = 0;
+  playlistSeed = micros();
+  shufflePlaylist();
+  playPlaylistEntry(true);
+  Serial.println("Playlist started");
+}
+
+void stopPlaylist() {
+  if (!playlistActive) return;
+  playlistActive = false;
+  savePlaylistPosition();
+  Serial.println("Playlist stopped");
+}
+
+void nextPlaylistEntry() {
+  uint8_t last = playlistOrder[playlistStep];
+  if (++playlistStep >= playlist.count) {
+    // New pass, new shuffle - without showing the last entry twice in a row
+    playlistStep = 0;
+    playlistSeed++;
+    shufflePlaylist();
+    if (playlist.count > 1 && playlistOrder[0] == last) {
+      playlistOrder[0] = playlistOrder[1];
+      playlistOrder[1] = last;
+    }
+  }
+  playlistSteps++;
+  playPlaylistEntry(true);
+}
+
+// Boot: load the list and carry on where the last run was
+void loadPlaylist() {
+  File file = LittleFS.open(PLAYLIST_FILE, "r");
+  if (!file) return;
+  size_t size = file.size();
+  bool valid = size >= playlistSize(0) && size <= sizeof(playlist) &&
+               file.read((uint8_t *)&playlist, size) == size &&
+               playlist.magic == PLAYLIST_MAGIC && playlist.count <= PLAYLIST_MAX_ENTRIES &&
+               size == playlistSize(playlist.count);
+  file.close();
+  uint32_t crc = 0;
+  if (valid) memcpy(&crc, (uint8_t *)&playlist + size - sizeof(uint32_t), sizeof(crc));
+  if (!valid || crc != playlistChecksum(playlist)) {
+    playlist.count = 0;
+    return;
+  }
+  
+  PlaylistPosition position;
+  file = LittleFS.open(PLAYLIST_POSITION_FILE, "r");
+  if (!file) return;
+  valid = file.read((uint8_t *)&position, sizeof(position)) == sizeof(position) &&
+          position.magic == PLAYLIST_MAGIC &&
+          position.crc == checksum32((const uint8_t *)&position, offsetof(PlaylistPosition, crc));
+  file.close();
+  if (!valid || !position.active || playlist.count == 0) return;
+  
+  playlistActive = true;
+  playlistSeed = position.seed;
+  playlistStep = position.step < playlist.count ? position.step : 0;
+  shufflePlaylist();
+  playPlaylistEntry(false);
+  Serial.print("Playlist resumed at step ");
+  Serial.println(playlistStep);
+}
+
+// Runs in loop(): take /playlist requests and move on when an entry is over
+void updatePlaylist() {
+  if (playlistChanged) {
+    playlistChanged = false;
+    bool wasActive = playlistActive;
+    memcpy(&playlist, &newPlaylist, sizeof(playlist));
+    playlistActive = false;
+    savePlaylist();
+    if (wasActive) startPlaylist();
+    else savePlaylistPosition();
+  }
+  
+  uint8_t command = playlistCommand;
+  playlistCommand = PLAYLIST_NONE;
+  if (command == PLAYLIST_START) startPlaylist();
+  else if (command == PLAYLIST_STOP) stopPlaylist();
+  else if (command == PLAYLIST_NEXT && playlistActive) nextPlaylistEntry();
+  
+  if (!playlistActive) return;
+  unsigned long now = millis();
+  if (musicPlaying || !isPoweredOn) {
+    playlistEntryStart = now; // The entry starts over afterwards
+    return;
+  }
+  
+  // A color or effect picked by hand ends the playlist
+  int32_t state[COMMAND_TYPES];
+  readCurrentState(state);
+  if (state[CMD_COLOR] != playlistShownColor || state[CMD_EFFECT] != playlistShownEffect) {
+    stopPlaylist();
+    return;
+  }
+  
+  const PlaylistEntry &entry = playlist.entries[playlistOrder[playlistStep]];
+  if (now - playlistEntryStart >= entry.seconds * 1000UL) nextPlaylistEntry();
+}
+
+// ========== CLOCK AND SCHEDULE ==========
+// Wall clock from the page (it sends the time and zone to /time when it
+// opens) or from SNTP once the lamp is on the home network. Up to
+// SCHEDULE_MAX_RULES daily rules in SCHEDULE_FILE dim the lamp, light it
+// with a sunrise, switch it on or off - each as a ramp over some minutes
+// through outputLevel, 16 bits with dithering and eased so the eye sees an
+// even change. A brightness or power change by hand ends a ramp, and so
+// does a color change during a sunrise (the one ramp that sets the color).
+// With circadian on, the white effects 80-84 take their white from the
+// color temperature curve below instead of their own tint.
+#define SCHEDULE_FILE "/schedule.bin"
+#define SCHEDULE_MAGIC 0x4843534F       // "OSCH"
+#define SCHEDULE_MAX_RULES 8
+#define SCHEDULE_MAX_MINUTES 240        // Longest ramp
+#define SCHEDULE_FRAME_INTERVAL 5       // ms between frames while a ramp runs
+#define SCHEDULE_NTP_SERVER "pool.ntp.org"
+#define CLOCK_VALID_EPOCH 1600000000UL  // Anything earlier is an unset clock
+#define CLOCK_NTP_INTERVAL 3600000UL    // Take the SNTP time every hour
+#define SUNRISE_START_KELVIN 1800
+#define SUNRISE_END_KELVIN 4500
+#define CIRCADIAN_DEFAULT_KELVIN 2700   // Until the clock is set
+#define KELVIN_MIN 1000
+#define KELVIN_MAX 10000
+#define KELVIN_STEP 100
+
+enum ScheduleAction : uint8_t { SCHEDULE_DIM, SCHEDULE_SUNRISE, SCHEDULE_OFF, SCHEDULE_ON };
+const char *const scheduleActionNames[] = {"dim", "sunrise", "off", "on"};
+enum ClockSource : uint8_t { CLOCK_NONE, CLOCK_PAGE, CLOCK_NTP };
+
+struct ScheduleRule {
+  uint16_t minute;                   // Local minute of the day
+  uint8_t action;
+  uint8_t value;                     // Brightness to end at (dim, sunrise)
+  uint8_t minutes;                   // Ramp length, 0 = at once
+} __attribute__((packed));
+
+struct Schedule {
+  uint32_t magic;
+  int16_t tzMinutes;                 // Local time minus UTC, from the page
+  uint8_t circadian;
+  uint8_t count;
+  ScheduleRule rules[SCHEDULE_MAX_RULES];
+  uint32_t crc;
+} __attribute__((packed));
+
+// Black body color from KELVIN_MIN to KELVIN_MAX in KELVIN_STEP steps
+// (Tanner Helland's fit), red, green, blue
+const uint8_t kelvinTable[] PROGMEM = {
+  255,  68,   0, 255,  77,   0, 255,  86,   0, 255,  94,   0, 255, 101,   0, 255, 108,   0,  // 1000 K
+  255, 115,   0, 255, 121,   0, 255, 126,   0, 255, 132,   0, 255, 137,  14, 255, 142,  27,  // 1600 K
+  255, 146,  39, 255, 151,  50, 255, 155,  61, 255, 159,  70, 255, 163,  79, 255, 167,  87,  // 2200 K
+  255, 170,  95, 255, 174, 103, 255, 177, 110, 255, 180, 117, 255, 184, 123, 255, 187, 129,  // 2800 K
+  255, 190, 135, 255, 193, 141, 255, 195, 146, 255, 198, 151, 255, 201, 157, 255, 203, 161,  // 3400 K
+  255, 206, 166, 255, 208, 171, 255, 211, 175, 255, 213, 179, 255, 215, 183, 255, 218, 187,  // 4000 K
+  255, 220, 191, 255, 222, 195, 255, 224, 199, 255, 226, 202, 255, 228, 206, 255, 230, 209,  // 4600 K
+  255, 232, 213, 255, 234, 216, 255, 236, 219, 255, 237, 222, 255, 239, 225, 255, 241, 228,  // 5200 K
+  255, 243, 231, 255, 244, 234, 255, 246, 237, 255, 248, 240, 255, 249, 242, 255, 251, 245,  // 5800 K
+  255, 253, 248, 255, 254, 250, 255, 255, 255, 254, 249, 255, 250, 246, 255, 246, 244, 255,  // 6400 K
+  243, 242, 255, 240, 240, 255, 237, 239, 255, 234, 237, 255, 232, 236, 255, 230, 235, 255,  // 7000 K
+  228, 234, 255, 226, 233, 255, 224, 232, 255, 223, 231, 255, 221, 230, 255, 220, 229, 255,  // 7600 K
+  218, 228, 255, 217, 227, 255, 216, 227, 255, 215, 226, 255, 214, 225, 255, 213, 225, 255,  // 8200 K
+  212, 224, 255, 211, 223, 255, 210, 223, 255, 209, 222, 255, 208, 222, 255, 207, 221, 255,  // 8800 K
+  206, 221, 255, 205, 220, 255, 205, 220, 255, 204, 219, 255, 203, 219, 255, 202, 218, 255,  // 9400 K
+  202, 218, 255,  // 10000 K
+};
+
+// Color temperature through the day: candle-warm at night, daylight from
+// late morning to afternoon, warm again through the evening
+const uint16_t circadianMinutes[] PROGMEM = {0, 360, 480, 660, 960, 1140, 1320, 1440};
+const uint16_t circadianKelvins[] PROGMEM = {1900, 1900, 4000, 5500, 5500, 3000, 1900, 1900};
+
+Schedule schedule;
+Schedule newSchedule;                // Written by /schedule?set=
+volatile bool scheduleChanged = false;
+volatile uint32_t pageClockEpoch = 0; // Written by /time, taken in loop()
+volatile int16_t pageClockTz = 0;
+
+uint32_t clockEpoch = 0;             // UTC seconds at clockMillis
+unsigned long clockMillis = 0;
+uint8_t clockSource = CLOCK_NONE;
+bool ntpStarted = false;
+unsigned long lastNtpCheck = 0;
+uint16_t scheduleMinute = 0xFFFF;    // Last minute the rules were checked for
+uint16_t currentKelvin = CIRCADIAN_DEFAULT_KELVIN;
+uint32_t circadianColor = 0;
+
+// The running ramp; levels are eased (square root of outputLevel)
+bool rampActive = false;
+uint8_t rampAction = SCHEDULE_DIM;
+uint16_t rampFrom = 0;
+uint16_t rampTo = 0;
+unsigned long rampStart = 0;
+unsigned long rampMillis = 0;
+unsigned long lastRampFrame = 0;
+unsigned long lastSunriseStep = 0;
+uint8_t rampEndBrightness = 0;
+int rampBrightness = 0;              // What the ramp left, to notice a change
+bool rampPower = false;              // by hand
+uint32_t rampColor = 0;
+
+// Schedule stats
+unsigned long scheduleRamps = 0;
+
+uint32_t kelvinColor(uint16_t kelvin) {
+  kelvin = constrain(kelvin, KELVIN_MIN, KELVIN_MAX);
+  uint16_t index = (kelvin - KELVIN_MIN) / KELVIN_STEP;
+  uint16_t fraction = (kelvin - KELVIN_MIN) % KELVIN_STEP * 256 / KELVIN_STEP;
+  if (index >= (KELVIN_MAX - KELVIN_MIN) / KELVIN_STEP) {
+    index = (KELVIN_MAX - KELVIN_MIN) / KELVIN_STEP - 1;
+    fraction = 256;
+  }
+  uint8_t rgb[3];
+  for (uint8_t c = 0; c < 3; c++) {
+    int from = pgm_read_byte(&kelvinTable[index * 3 + c]);
+    int to = pgm_read_byte(&kelvinTable[index * 3 + 3 + c]);
+    rgb[c] = from + (to - from) * (int)fraction / 256;
+  }
+  return strip.Color(rgb[0], rgb[1], rgb[2]);
+}
+
+// The circadian color at a level, for the white effects
+uint32_t circadianWhite(uint8_t level) {
+  return strip.Color((uint8_t)(circadianColor >> 16) * level / 255,
+                     (uint8_t)(circadianColor >> 8) * level / 255,
+                     (uint8_t)circadianColor * level / 255);
+}
+
+void setClock(uint32_t epoch, uint8_t source) {
+  clockEpoch = epoch;
+  clockMillis = millis();
+  clockSource = source;
+}
+
+uint32_t localSecondOfDay() {
+  uint32_t epoch = clockEpoch + (millis() - clockMillis) / 1000;
+  return (epoch + (int32_t)schedule.tzMinutes * 60) % 86400UL;
+}
+
+uint16_t circadianKelvin() {
+  if (clockSource == CLOCK_NONE) return CIRCADIAN_DEFAULT_KELVIN;
+  uint32_t second = localSecondOfDay();
+  uint8_t i = 1;
+  while (pgm_read_word(&circadianMinutes[i]) * 60UL <= second) i++;
+  uint32_t from = pgm_read_word(&circadianMinutes[i - 1]) * 60UL;
+  uint32_t to = pgm_read_word(&circadianMinutes[i]) * 60UL;
+  int32_t kelvinFrom = pgm_read_word(&circadianKelvins[i - 1]);
+  int32_t kelvinTo = pgm_read_word(&circadianKelvins[i]);
+  return kelvinFrom + (kelvinTo - kelvinFrom) * (int32_t)(second - from) / (int32_t)(to - from);
+}
+
+uint32_t scheduleChecksum(const Schedule &s) {
+  return checksum32((const uint8_t *)&s, offsetof(Schedule, crc));
+}
+
+void saveSchedule() {
+  schedule.crc = scheduleChecksum(schedule);
+  bool sampling = micRunning;
+  stopMicSampler();
+  File file = LittleFS.open(SCHEDULE_FILE, "w");
+  if (file) {
+    file.write((const uint8_t *)&schedule, sizeof(schedule));
+    file.close();
+  } else {
+    Serial.println("Schedule: could not save");
+  }
+  if (sampling) startMicSampler();
+}
+
+void loadSchedule() {
+  File file = LittleFS.open(SCHEDULE_FILE, "r");
+  bool valid = file && file.read((uint8_t *)&schedule, sizeof(schedule)) == sizeof(schedule) &&
+               schedule.magic == SCHEDULE_MAGIC && schedule.count <= SCHEDULE_MAX_RULES &&
+               schedule.crc == scheduleChecksum(schedule);
+  if (file) file.close();
+  if (!valid) {
+    memset(&schedule, 0, sizeof(schedule));
+    schedule.magic = SCHEDULE_MAGIC;
+  }
+  circadianColor = kelvinColor(currentKelvin);
+}
+
+void applyScheduleCommand(uint8_t type, int32_t value) {
+  ControlCommand cmd;
+  cmd.type = type;
+  cmd.value = value;
+  cmd.queuedMicros = micros();
+  applyCommand(cmd);
+}
+
+// Eased level: a ramp moves this evenly, the LEDs get its square
+uint16_t easedLevel(uint32_t level) {
+  return sqrt(level / 65535.0) * 65535 + 0.5;
+}
+
+void noteRampState() {
+  rampBrightness = currentBrightness;
+  rampPower = isPoweredOn;
+  rampColor = currentColor;
+}
+
+void startRamp(const ScheduleRule &rule) {
+  if (musicPlaying || realtimeActive) return;
+  if ((rule.action == SCHEDULE_DIM || rule.action == SCHEDULE_OFF) && !isPoweredOn) return;
+  if (rule.action == SCHEDULE_ON && isPoweredOn) return;
+  
+  // Whatever the last ramp left is where this one starts
+  uint32_t level = rampActive ? outputLevel : 65535;
+  
+  // A rule that would do nothing leaves a running ramp as it is
+  int from = currentBrightness * level / 65535;
+  int top = max(from, (int)rule.value);
+  if (rule.action == SCHEDULE_DIM && top == 0) return;
+  if (rule.action == SCHEDULE_SUNRISE && rule.value == 0) return;
+  
+  rampAction = rule.action;
+  rampEndBrightness = currentBrightness;
+  switch (rule.action) {
+    case SCHEDULE_DIM:
+      // Draw at the brighter end and scale the output down from there
+      rampFrom = easedLevel(from * 65535UL / top);
+      rampTo = easedLevel(rule.value * 65535UL / top);
+      rampEndBrightness = rule.value;
+      outputLevel = from * 65535UL / top;
+      applyScheduleCommand(CMD_BRIGHTNESS, top);
+      break;
+    case SCHEDULE_SUNRISE:
+      // From dark, or from what is showing if that is dimmer than the end
+      if (!isPoweredOn) from = 0;
+      else if (from > rule.value) from = rule.value;
+      outputLevel = from * 65535UL / rule.value;
+      rampFrom = easedLevel(outputLevel);
+      rampTo = 65535;
+      rampEndBrightness = rule.value;
+      applyScheduleCommand(CMD_POWER, 1);
+      applyScheduleCommand(CMD_COLOR, kelvinColor(SUNRISE_START_KELVIN));
+      applyScheduleCommand(CMD_BRIGHTNESS, rule.value);
+      break;
+    case SCHEDULE_OFF:
+      rampFrom = easedLevel(level);
+      rampTo = 0;
+      break;
+    case SCHEDULE_ON:
+      rampFrom = 0;
+      rampTo = 65535;
+      outputLevel = 0;
+      applyScheduleCommand(CMD_POWER, 1);
+      break;
+  }
+  noteRampState();
+  rampStart = millis();
+  rampMillis = rule.minutes * 60000UL;
+  lastSunriseStep = rampStart;
+  rampActive = true;
+  scheduleRamps++;
+  
+  Serial.print("Schedule: ");
+  Serial.print(scheduleActionNames[rule.action]);
+  Serial.print(" over ");
+  Serial.print(rule.minutes);
+  Serial.println(" min");
+}
+
+void finishRamp() {
+  rampActive = false;
+  if (rampAction == SCHEDULE_DIM) {
+    applyScheduleCommand(CMD_BRIGHTNESS, rampEndBrightness);
+  } else if (rampAction == SCHEDULE_SUNRISE) {
+    applyScheduleCommand(CMD_COLOR, kelvinColor(SUNRISE_END_KELVIN));
+  } else if (rampAction == SCHEDULE_OFF) {
+    applyScheduleCommand(CMD_POWER, 0);
+  }
+  outputLevel = 65535;
+  strip.show();
+}
+
+void updateRamp() {
+  // A change by hand ends the ramp where the hand put it
+  if (currentBrightness != rampBrightness || isPoweredOn != rampPower ||
+      (rampAction == SCHEDULE_SUNRISE && currentColor != rampColor)) {
+    rampActive = false;
+    outputLevel = 65535;
+    return;
+  }
+  
+  unsigned long now = millis();
+  unsigned long elapsed = now - rampStart;
+  if (elapsed >= rampMillis) {
+    finishRamp();
+    return;
+  }
+  if (now - lastRampFrame < SCHEDULE_FRAME_INTERVAL) return;
+  lastRampFrame = now;
+  
+  uint32_t eased = rampFrom + ((int32_t)rampTo - rampFrom) * (int64_t)elapsed / (int64_t)rampMillis;
+  outputLevel = eased * eased / 65535;
+  
+  // Sunrise: the color warms up to daylight along the way
+  if (rampAction == SCHEDULE_SUNRISE && now - lastSunriseStep >= 1000) {
+    lastSunriseStep = now;
+    uint16_t kelvin = SUNRISE_START_KELVIN +
+                      (uint64_t)(SUNRISE_END_KELVIN - SUNRISE_START_KELVIN) * elapsed / rampMillis;
+    currentColor = kelvinColor(kelvin);
+    for (int i = 0; i < NUM_LEDS; i++) {
+      strip.setPixelColor(i, currentColor);
+    }
+    rampColor = currentColor;
+  }
+  
+  // Keep the dithered output moving even when no effect draws
+  strip.show();
+}
+
+// Runs in loop(): clock, rule changes from /schedule, rules and ramps
+void updateSchedule() {
+  if (scheduleChanged) {
+    scheduleChanged = false;
+    newSchedule.tzMinutes = schedule.tzMinutes;
+    memcpy(&schedule, &newSchedule, sizeof(schedule));
+    saveSchedule();
+    scheduleMinute = 0xFFFF;
+  }
+  
+  if (pageClockEpoch) {
+    if (clockSource != CLOCK_NTP) setClock(pageClockEpoch, CLOCK_PAGE);
+    pageClockEpoch = 0;
+    if (pageClockTz != schedule.tzMinutes) {
+      schedule.tzMinutes = pageClockTz;
+      saveSchedule();
+    }
+  }
+  
+  unsigned long now = millis();
+  if (wifiState == WIFI_STATE_STATION) {
+    if (!ntpStarted) {
+      configTime(0, 0, SCHEDULE_NTP_SERVER);
+      ntpStarted = true;
+    }
+    if (clockSource != CLOCK_NTP || now - lastNtpCheck >= CLOCK_NTP_INTERVAL) {
+      time_t ntpTime = time(nullptr);
+      if (ntpTime > (time_t)CLOCK_VALID_EPOCH) {
+        setClock(ntpTime, CLOCK_NTP);
+        lastNtpCheck = now;
+      }
+    }
+  }
+  
+  if (rampActive) updateRamp();
+  
+  static unsigned long lastScheduleCheck = 0;
+  if (clockSource == CLOCK_NONE || now - lastScheduleCheck < 1000) return;
+  lastScheduleCheck = now;
+  
+  // Move the clock base on before millis() - clockMillis can wrap
+  uint32_t seconds = (now - clockMillis) / 1000;
+  if (seconds >= 3600) {
+    clockEpoch += seconds;
+    clockMillis += seconds * 1000;
+  }
+  
+  currentKelvin = circadianKelvin();
+  circadianColor = kelvinColor(currentKelvin);
+  
+  uint16_t minute = localSecondOfDay() / 60;
+  if (minute == scheduleMinute) return;
+  scheduleMinute = minute;
+  for (uint8_t i = 0; i < schedule.count; i++) {
+    if (schedule.rules[i].minute == minute) startRamp(schedule.rules[i]);
+  }
+}
+
+// ========== TOUCH GESTURES ==========
+// What tap, double tap, triple tap and hold do, kept in TOUCH_MAP_FILE and
+// changed with /touch. A hold mapped to dim moves the brightness while the
+// finger stays on, up or down (the other way than last time), eased like
+// the schedule ramps so the change looks even; a hold on a lamp that is off
+// switches it on and brightens from the bottom. Any other action on a hold
+// runs once when the hold starts.
+#define TOUCH_MAP_FILE "/touch.bin"
+#define TOUCH_MAP_MAGIC 0x4843544F      // "OTCH"
+#define TOUCH_DIM_TIME 3000             // ms for a hold to cross the whole brightness range
+#define TOUCH_DIM_INTERVAL 10           // ms between brightness steps
+
+enum TouchAction : uint8_t {
+  TOUCH_NONE,
+  TOUCH_NEXT_EFFECT,
+  TOUCH_PREVIOUS_EFFECT,
+  TOUCH_POWER,
+  TOUCH_DIM,                            // Tap: step down through TOUCH_DIM_STEPS
+  TOUCH_PLAYLIST,                       // Next entry, or start the playlist
+  TOUCH_PRESET,                         // Recall the slot in param
+  TOUCH_ACTIONS
+};
+const char *const touchActionNames[] = {"none", "next", "previous", "power", "dim", "playlist", "preset"};
+const char *const touchGestureNames[] = {"tap", "double", "triple", "hold"};
+const uint8_t touchDimSteps[] = {255, 128, 64, 16};
+
+struct TouchMap {
+  uint32_t magic;
+  uint8_t action[TOUCH_GESTURES];
+  uint8_t param[TOUCH_GESTURES];
+  uint32_t crc;
+} __attribute__((packed));
+
+TouchMap touchMap = {TOUCH_MAP_MAGIC, {TOUCH_NEXT_EFFECT, TOUCH_POWER, TOUCH_PREVIOUS_EFFECT, TOUCH_DIM},
+                     {0, 0, 0, 0}, 0};
+TouchMap newTouchMap;                   // Written by /touch?...
+volatile bool touchMapChanged = false;
+
+uint16_t holdLevel = 0;                 // Eased brightness while a hold dims
+int8_t holdDirection = 1;
+unsigned long lastHoldStep = 0;
+
+// Gesture stats
+unsigned long touchGestures[TOUCH_GESTURES];
+
+uint32_t touchMapChecksum(const TouchMap &map) {
+  return checksum32((const uint8_t *)&map, offsetof(TouchMap, crc));
+}
+
+void loadTouchMap() {
+  TouchMap saved;
+  File file = LittleFS.open(TOUCH_MAP_FILE, "r");
+  bool valid = file && file.read((uint8_t *)&saved, sizeof(saved)) == sizeof(saved) &&
+               saved.magic == TOUCH_MAP_MAGIC && saved.crc == touchMapChecksum(saved);
+  if (file) file.close();
+  for (uint8_t i = 0; valid && i < TOUCH_GESTURES; i++) {
+    valid = saved.action[i] < TOUCH_ACTIONS && saved.param[i] < PRESET_SLOTS;
+  }
+  if (valid) memcpy(&touchMap, &saved, sizeof(touchMap));
+}
+
+void saveTouchMap() {
+  touchMap.crc = touchMapChecksum(touchMap);
+  bool sampling = micRunning;
+  stopMicSampler();
+  File file = LittleFS.open(TOUCH_MAP_FILE, "w");
+  if (file) {
+    file.write((const uint8_t *)&touchMap, sizeof(touchMap));
+    file.close();
+  } else {
+    Serial.println("Touch: could not save the gestures");
+  }
+  if (sampling) startMicSampler();
+}
+
+bool touchGestureUsed(uint8_t gesture) {
+  return touchMap.action[gesture] != TOUCH_NONE;
+}
+
+void touchStepEffect(int step) {
+  touchMode = true; // Switch to touch control mode
+  
+  // Cycle through the 100 effects
+  touchEffectIndex = (touchEffectIndex + step + 100) % 100;
+  
+  // Set the effect
+  currentEffect = touchEffectIndex;
+  isEffectRunning = true;
+  effectCounter = 0;
+  effectPosition = 0;
+  hueCounter = 0;
+  
+  Serial.print("Touch: Changed to effect ");
+  Serial.println(touchEffectIndex);
+}
+
+void touchTogglePower() {
+  isPoweredOn = !isPoweredOn;
+  touchMode = true; // Switch to touch control mode
+  
+  if (!isPoweredOn) {
+    // Turn off all LEDs
+    for (int i = 0; i < NUM_LEDS; i++) {
+      strip.setPixelColor(i, 0);
+    }
+    isEffectRunning = false;
+  } else {
+    // Turn on with current effect
+    isEffectRunning = true;
+  }
+  
+  Serial.print("Touch: Power ");
+  Serial.println(isPoweredOn ? "ON" : "OFF");
+}
+
+// Brightness without the command log - a hold sets it every few ms
+void setTouchBrightness(uint8_t brightness) {
+  currentBrightness = brightness;
+  strip.setBrightness(brightness);
+  // setBrightness() rescales the buffer and loses bits - draw a solid color again
+  if (!isEffectRunning && isPoweredOn) {
+    for (int i = 0; i < NUM_LEDS; i++) {
+      strip.setPixelColor(i, currentColor);
+    }
+  }
+}
+
+void runTouchGesture(uint8_t gesture, unsigned long dueMicros) {
+  uint8_t action = touchMap.action[gesture];
+  uint8_t blinks = 1; // Visual feedback - blink once
+  touchGestures[gesture]++;
+  
+  switch (action) {
+    case TOUCH_NEXT_EFFECT:
+      touchStepEffect(1);
+      break;
+    case TOUCH_PREVIOUS_EFFECT:
+      touchStepEffect(-1);
+      break;
+    case TOUCH_POWER:
+      touchTogglePower();
+      blinks = isPoweredOn ? 2 : 0; // Blink twice when it comes on
+      break;
+    case TOUCH_DIM:
+      {
+        uint8_t step = 0;
+        while (step < sizeof(touchDimSteps) - 1 && touchDimSteps[step] > currentBrightness) step++;
+        if (touchDimSteps[step] == currentBrightness) step++;
+        setTouchBrightness(touchDimSteps[step % sizeof(touchDimSteps)]);
+      }
+      blinks = 0;
+      break;
+    case TOUCH_PLAYLIST:
+      playlistCommand = playlistActive ? PLAYLIST_NEXT : PLAYLIST_START;
+      break;
+    case TOUCH_PRESET:
+      if (presetUsed & (1UL << touchMap.param[gesture])) presetRecallSlot = touchMap.param[gesture];
+      break;
+    default:
+      return;
+  }
+  
+  if (blinks && isPoweredOn) startTouchFeedback(blinks);
+  strip.show();
+  recordTouchLatency(dueMicros);
+  Serial.print("Touch: ");
+  Serial.println(touchGestureNames[gesture]);
+}
+
+void touchHoldStart(unsigned long dueMicros) {
+  if (touchMap.action[GESTURE_HOLD] != TOUCH_DIM) {
+    runTouchGesture(GESTURE_HOLD, dueMicros);
+    return;
+  }
+  touchGestures[GESTURE_HOLD]++;
+  
+  if (!isPoweredOn) {
+    // From off: on at the bottom, then brighter while held
+    touchTogglePower();
+    setTouchBrightness(1);
+    holdDirection = 1;
+  } else {
+    holdDirection = -holdDirection;
+    if (currentBrightness >= 255) holdDirection = -1;
+    if (currentBrightness <= 1) holdDirection = 1;
+  }
+  holdLevel = easedLevel(currentBrightness * 257UL);
+  lastHoldStep = millis();
+  strip.show();
+  recordTouchLatency(dueMicros);
+  Serial.println(holdDirection > 0 ? "Touch: brighter" : "Touch: dimmer");
+}
+
+void touchHoldUpdate() {
+  if (touchMap.action[GESTURE_HOLD] != TOUCH_DIM) return;
+  unsigned long now = millis();
+  if (now - lastHoldStep < TOUCH_DIM_INTERVAL) return;
+  
+  int32_t step = (now - lastHoldStep) * 65535L / TOUCH_DIM_TIME;
+  lastHoldStep = now;
+  int32_t level = constrain((int32_t)holdLevel + holdDirection * step, 0L, 65535L);
+  holdLevel = level;
+  
+  // Eased back to brightness, never down to off
+  uint32_t brightness = ((uint32_t)level * level / 65535 + 128) >> 8;
+  if (brightness < 1) brightness = 1;
+  if ((int)brightness != currentBrightness) {
+    setTouchBrightness(brightness);
+    strip.show();
+  }
+}
+
+void touchHoldEnd() {
+  if (touchMap.action[GESTURE_HOLD] != TOUCH_DIM) return;
+  Serial.print("Touch: brightness ");
+  Serial.println(currentBrightness);
+}
+
+// Runs in loop(): a new mapping from /touch
+void updateTouchMap() {
+  if (!touchMapChanged) return;
+  memcpy(&touchMap, &newTouchMap, sizeof(touchMap));
+  touchMapChanged = false;
+  saveTouchMap();
+}
+
+// Handle web requests - these run in the async server's TCP callbacks
+
+// Reply with a constant string. beginResponse_P() sends straight from it
+// instead of copying it into a String first - only for literals, which
+// stay put however long the reply takes to go out.
+void sendReply(AsyncWebServerRequest *request, int code, const char *type, const char *message) {
+  request->send(request->beginResponse_P(code, type, (const uint8_t *)message, strlen(message)));
+}
+
+// Reply with text formatted into a handler's buffer. The response keeps
+// its own copy: a reply longer than the TCP window is finished as ACKs
+// arrive, when the next request may already be reusing the buffer.
+void sendBuffer(AsyncWebServerRequest *request, int code, const char *type, const char *message) {
+  size_t length = strlen(message);
+  AsyncResponseStream *response = request->beginResponseStream(type, length);
+  response->setCode(code);
+  response->write((const uint8_t *)message, length);
+  request->send(response);
+}
+
+void handleRoot(AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response;
+  
+  // Let the phone revalidate its cached copy instead of downloading it again
+  if (request->hasHeader("If-None-Match") &&
+      request->getHeader("If-None-Match")->value() == INDEX_HTML_ETAG) {
+    response = request->beginResponse(304);
+  } else {
+    if (request->hasHeader("Accept-Encoding") &&
+        request->getHeader("Accept-Encoding")->value().indexOf("gzip") >= 0) {
+      // Pre-compressed page (~11 KB instead of ~56 KB) served straight from flash.
+      // The server sends it piece by piece as the phone acknowledges data.
+      response = request->beginResponse_P(200, "text/html", index_html_gz, index_html_gz_len);
+      response->addHeader("Content-Encoding", "gzip");
+    } else {
+      response = request->beginResponse_P(200, "text/html", index_html);
+    }
+    
+    pageLoads++;
+    if (activePageLoads++ == 0) pageLoadFrameGapMicros = 0;
+    request->onDisconnect([]() {
+      activePageLoads--;
+    });
+  }
+  
+  response->addHeader("ETag", INDEX_HTML_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+void handleStats(AsyncWebServerRequest *request) {
+  static char message[2560];
+  snprintf(message, sizeof(message),
+           "maxFrameGapUs: %lu\npageLoadFrameGapUs: %lu\npageLoads: %lu\n"
+           "controlRequests: %lu\ncontrolUpdatesApplied: %lu\ncontrolFrames: %lu\n"
+           "commandLatencyP50Us: %lu\ncommandLatencyP90Us: %lu\ncommandLatencyP99Us: %lu\n"
+           "wsClients: %u\nwsCommands: %lu\nwsCommandCostUs: %lu\nstatePushes: %lu\n"
+           "realtimeActive: %d\nrealtimeFps: %lu\nrealtimePackets: %lu\nrealtimeLost: %lu\n"
+           "realtimeLatencyAvgUs: %lu\nrealtimeLatencyMaxUs: %lu\n"
+           "syncRole: %u\nsyncLocked: %d\nsyncBeacons: %lu\nsyncErrorUs: %ld\n"
+           "syncSkewUs: %lu\nsyncDriftPpm: %ld\nsyncAdoptions: %lu\n"
+           "wifiState: %u\nwifiJoinMs: %lu\nwifiReconnectMs: %lu\nwifiReconnects: %lu\n"
+           "heapFree: %lu\nheapMaxBlock: %lu\nheapFragmentation: %u\nheapMinFree: %lu\n"
+           "audioLive: %d\naudioFrames: %lu\naudioLost: %lu\naudioLate: %lu\naudioUnderruns: %lu\n"
+           "audioSkipped: %lu\naudioAgeUs: %lu\naudioLatencyUs: %lu\naudioLatencyTargetMs: %u\n"
+           "audioJitterUs: %lu\naudioJitterMaxMs: %lu\n"
+           "micFrames: %lu\nmicLateSamples: %lu\nmicAgcPeak: %u\nmicAnalysisCycles: %lu\n"
+           "micAnalysisMaxCycles: %lu\nmicReadMaxCycles: %lu\nmicCpuPermille: %lu\nmicTopHz: %u\n"
+           "onsets: %lu\nbeats: %lu\nbeatLocked: %d\nbeatBpm: %u\nbeatPhaseErrorMs: %d\n"
+           "timelinePlaying: %d\ntimelineFrames: %lu\ntimelineReads: %lu\ntimelineReadMaxUs: %lu\n"
+           "stateSaves: %lu\nstateCompactions: %lu\nstateSaveMaxUs: %lu\nstateRestoreUs: %lu\n"
+           "bootFirstFrameMs: %lu\nbootReadyMs: %lu\nbootSelfTest: %d\n"
+           "presetSaves: %lu\npresetRecalls: %lu\npresetRecallMaxUs: %lu\n"
+           "playlistActive: %d\nplaylistSteps: %lu\n"
+           "clockSource: %u\nscheduleRamp: %d\nscheduleRamps: %lu\noutputLevel: %u\nkelvin: %u\n"
+           "touchPresses: %lu\ntouchBounces: %lu\ntouchDropped: %lu\ntouchLatencyUs: %lu\n"
+           "touchLatencyMaxUs: %lu\ntouchTaps: %lu\ntouchDoubleTaps: %lu\ntouchTripleTaps: %lu\n"
+           "touchHolds: %lu\n",
+           maxFrameGapMicros, pageLoadFrameGapMicros, pageLoads,
+           controlRequestsReceived, controlUpdatesApplied, controlFramesApplied,
+           latencyPercentile(50), latencyPercentile(90), latencyPercentile(99),
+           (unsigned int)ws.count(), wsCommands,
+           wsCommands ? wsHandlerMicros / wsCommands : 0, statePushes,
+           realtimeActive, realtimeFps, realtimePackets, realtimeLost,
+           realtimeFrames ? realtimeLatencyTotalMicros / realtimeFrames : 0,
+           realtimeLatencyMaxMicros,
+           (unsigned int)syncRole, syncLocked, syncBeacons, (long)syncLastErrorMicros,
+           (unsigned long)syncSkewMicros, (long)(syncDrift * 1000000), syncAdoptions,
+           (unsigned int)wifiState, staJoinMillis, staReconnectMillis, staReconnects,
+           (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMaxFreeBlockSize(),
+           (unsigned int)ESP.getHeapFragmentation(), (unsigned long)minFreeHeap,
+           audioLive, audioFrames, audioLost, audioLate, audioUnderruns,
+           audioSkipped, audioAgeMicros, audioLatencyMicros, (unsigned int)audioLatencyTarget,
+           audioJitterMicros, max(audioJitterMax, audioJitterPrevMax),
+           micFrames, micLateSamples, (unsigned int)micAgcPeak, (unsigned long)micAnalysisCycles,
+           (unsigned long)micAnalysisMaxCycles, (unsigned long)micReadMaxCycles,
+           // Share of the CPU taken by sampling plus analysis
+           (unsigned long)(((uint64_t)micReadMaxCycles * MIC_SAMPLE_RATE +
+                            (uint64_t)micAnalysisCycles * MIC_SAMPLE_RATE / MIC_HOP) * 1000 / F_CPU),
+           (unsigned int)MIC_TOP_HZ,
+           onsets, beats, beatLocked, (unsigned int)(60000 / beatPeriod), (int)beatPhaseError,
+           timelinePlaying, timelineFrames, timelineReads, timelineReadMaxMicros,
+           stateSaves, stateCompactions, stateSaveMaxMicros, stateRestoreMicros,
+           bootFirstFrameMillis, bootReadyMillis, bootSelfTest,
+           presetSaves, presetRecalls, presetRecallMaxMicros,
+           playlistActive, playlistSteps,
+           (unsigned int)clockSource, rampActive, scheduleRamps, (unsigned int)outputLevel,
+           (unsigned int)currentKelvin,
+           touchPresses, touchBounces, (unsigned long)touchDropped, touchLatencyMicros,
+           touchLatencyMaxMicros, touchGestures[GESTURE_TAP], touchGestures[GESTURE_DOUBLE_TAP],
+           touchGestures[GESTURE_TRIPLE_TAP], touchGestures[GESTURE_HOLD]);
+  sendBuffer(request, 200, "text/plain", message);
+}
+
+// ========== WEBSOCKET CONTROL CHANNEL ==========
+// The web page keeps one socket open and sends every control as a binary
+// message instead of a new HTTP request. A message holds one or more
+// commands, each a CommandType byte followed by its payload:
+//   CMD_COLOR                       r, g, b
+//   CMD_MUSIC_PLAY, CMD_MUSIC_STOP  no payload
+//   CMD_PING                        4 bytes, echoed back for round-trip timing
+//   CMD_AUDIO_FRAME                 seq, flags (0), send time ms (2 bytes),
+//                                   AUDIO_BANDS levels
+//   CMD_TIMELINE_PLAY               song position ms (4 bytes, TIMELINE_STOP
+//                                   stops), start delay ms (2 bytes)
+//   everything else                 one value byte
+
+// Payload length of a command, or -1 for an unknown command
+int commandPayloadSize(uint8_t type) {
+  switch (type) {
+    case CMD_COLOR: return 3;
+    case CMD_MUSIC_PLAY:
+    case CMD_MUSIC_STOP: return 0;
+    case CMD_PING: return 4;
+    case CMD_AUDIO_FRAME: return AUDIO_FRAME_SIZE;
+    case CMD_TIMELINE_PLAY: return 6;
+    default: return (type <= CMD_GLOWING_SPEED) ? 1 : -1;
+  }
+}
+
+void handleControlMessage(AsyncWebSocketClient *client, const uint8_t *data, size_t len) {
+  size_t pos = 0;
+  while (pos < len) {
+    uint8_t type = data[pos++];
+    int size = commandPayloadSize(type);
+    if (size < 0 || pos + size > len) return; // Malformed - drop the rest
+    
+    const uint8_t *payload = data + pos;
+    pos += size;
+    
+    if (type == CMD_PING) {
+      client->binary(data + pos - size - 1, size + 1);
+      continue;
+    }
+    
+    if (type == CMD_AUDIO_FRAME) {
+      lastSocketAudio = millis();
+      pushAudioFrame(payload, AUDIO_SOURCE_PAGE);
+      continue;
+    }
+    
+    if (type == CMD_TIMELINE_PLAY) {
+      uint32_t position = ((uint32_t)payload[0] << 24) | ((uint32_t)payload[1] << 16) |
+                          ((uint32_t)payload[2] << 8) | payload[3];
+      requestTimeline(position, ((uint16_t)payload[4] << 8) | payload[5]);
+      continue;
+    }
+    
+    int32_t value = 0;
+    if (type == CMD_COLOR) {
+      value = ((int32_t)payload[0] << 16) | ((int32_t)payload[1] << 8) | payload[2];
+    } else if (size == 1) {
+      value = payload[0];
+    }
+    queueCommand(type, value);
+    wsCommands++;
+  }
+}
+
+// ========== LIVE STATE PUSH ==========
+// Every connected page gets the settings that changed, from any source
+// (other phones, touch sensor), as commands in the same binary format.
+// One shared buffer is built per broadcast no matter how many clients are
+// connected, and nothing is sent while any client still has a backlog.
+#define STATE_PUSH_INTERVAL 50  // ms between state checks
+#define STATE_MESSAGE_SIZE 32   // Enough for every setting at once
+
+int32_t pushedState[COMMAND_TYPES]; // What the clients were last sent
+bool statePushed = false;
+
+// Current settings, indexed like the commands that set them
+void readCurrentState(int32_t *state) {
+  state[CMD_COLOR] = currentColor & 0xFFFFFF;
+  state[CMD_BRIGHTNESS] = currentBrightness;
+  state[CMD_POWER] = isPoweredOn;
+  state[CMD_EFFECT] = isEffectRunning ? currentEffect : NO_EFFECT;
+  state[CMD_MUSIC_PLAY] = musicPlaying;
+  state[CMD_MUSIC_STOP] = 0; // Folded into CMD_MUSIC_PLAY
+  state[CMD_MUSIC_EFFECT] = currentMusicEffect;
+  state[CMD_DENSITY] = musicDensity;
+  state[CMD_ROUGHNESS] = musicRoughness;
+  state[CMD_EFFECT_SPEED] = effectSpeed;
+  state[CMD_GLOWING_SPEED] = glowingSpeed;
+}
+
+// Encode the settings that differ from previous (all of them if NULL)
+size_t buildStateMessage(uint8_t *message, const int32_t *state, const int32_t *previous) {
+  size_t len = 0;
+  for (uint8_t type = 0; type < COMMAND_TYPES; type++) {
+    if (type == CMD_MUSIC_STOP) continue;
+    if (previous && state[type] == previous[type]) continue;
+    
+    if (type == CMD_COLOR) {
+      message[len++] = CMD_COLOR;
+      message[len++] = (state[type] >> 16) & 0xFF;
+      message[len++] = (state[type] >> 8) & 0xFF;
+      message[len++] = state[type] & 0xFF;
+    } else if (type == CMD_MUSIC_PLAY) {
+      message[len++] = state[type] ? CMD_MUSIC_PLAY : CMD_MUSIC_STOP;
+    } else {
+      message[len++] = type;
+      message[len++] = state[type];
+    }
+  }
+  return len;
+}
+
+void broadcastStateChanges() {
+  static unsigned long lastCheck = 0;
+  if (millis() - lastCheck < STATE_PUSH_INTERVAL) return;
+  lastCheck = millis();
+  
+  int32_t state[COMMAND_TYPES];
+  readCurrentState(state);
+  if (ws.count() == 0) {
+    memcpy(pushedState, state, sizeof(state)); // New clients get a full snapshot anyway
+    statePushed = true;
+    return;
+  }
+  if (!ws.availableForWriteAll()) return; // Retry once every client has caught up
+  
+  uint8_t message[STATE_MESSAGE_SIZE];
+  size_t len = buildStateMessage(message, state, statePushed ? pushedState : NULL);
+  if (len == 0) return;
+  
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(len);
+  if (!buffer) return;
+  memcpy(buffer->get(), message, len);
+  ws.binaryAll(buffer);
+  
+  memcpy(pushedState, state, sizeof(state));
+  statePushed = true;
+  statePushes++;
+}
+
+void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
+                      AwsEventType type, void *arg, uint8_t *data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    Serial.print("Control socket connected: client ");
+    Serial.println(client->id());
+    
+    // Bring the new page up to date
+    int32_t state[COMMAND_TYPES];
+    uint8_t message[STATE_MESSAGE_SIZE];
+    readCurrentState(state);
+    client->binary(message, buildStateMessage(message, state, NULL));
+  } else if (type == WS_EVT_DISCONNECT) {
+    Serial.print("Control socket closed: client ");
+    Serial.println(client->id());
+  } else if (type == WS_EVT_DATA) {
+    AwsFrameInfo *info = (AwsFrameInfo *)arg;
+    // Control messages are tiny - only complete single-frame binary messages are accepted
+    if (info->final && info->index == 0 && info->len == len && info->opcode == WS_BINARY) {
+      unsigned long startMicros = micros();
+      handleControlMessage(client, data, len);
+      wsHandlerMicros += micros() - startMicros;
+    }
+  }
+}
+
+// /selftest runs the full LED self-test (about 27 s, the lamp is busy
+// meanwhile) and puts the settings back afterwards
+void handleSelfTest(AsyncWebServerRequest *request) {
+  selfTestRequested = true;
+  sendReply(request, 200, "text/plain", "Self-test starting");
+}
+
+// /sync?role=leader|follower|off
+void handleSync(AsyncWebServerRequest *request) {
+  if (request->hasParam("role")) {
+    const String &role = request->getParam("role")->value();
+    if (role == "leader") syncRole = SYNC_LEADER;
+    else if (role == "follower") syncRole = SYNC_FOLLOWER;
+    else if (role == "off") syncRole = SYNC_OFF;
+    else {
+      sendReply(request, 400, "text/plain", "Invalid role");
+      return;
+    }
+  }
+  sendReply(request, 200, "text/plain",
+                syncRole == SYNC_LEADER ? "leader" : syncRole == SYNC_FOLLOWER ? "follower" : "off");
+}
+
+// GET /wifi shows the network, POST /wifi (form fields ssid, password)
+// saves a home network to join; an empty ssid goes back to the own AP
+void handleWifiStatus(AsyncWebServerRequest *request) {
+  IPAddress ip = lampIP();
+  static char message[160];
+  snprintf(message, sizeof(message), "mode: %s\nssid: %s\nip: %u.%u.%u.%u\nrssi: %ld\n",
+           wifiState == WIFI_STATE_STATION ? "station" :
+           wifiState == WIFI_STATE_CONNECTING ? "connecting" : "ap",
+           wifiConfigValid ? wifiConfig.ssid : ssid,
+           ip[0], ip[1], ip[2], ip[3],
+           wifiState == WIFI_STATE_STATION ? (long)WiFi.RSSI() : 0L);
+  sendBuffer(request, 200, "text/plain", message);
+}
+
+void handleWifiConfig(AsyncWebServerRequest *request) {
+  if (!request->hasParam("ssid", true)) {
+    sendReply(request, 400, "text/plain", "Missing ssid");
+    return;
+  }
+  const String &newSsid = request->getParam("ssid", true)->value();
+  const char *newPassword = request->hasParam("password", true) ?
+                            request->getParam("password", true)->value().c_str() : "";
+  size_t passwordLength = strlen(newPassword);
+  if (newSsid.length() >= sizeof(newWifiConfig.ssid) ||
+      passwordLength >= sizeof(newWifiConfig.password) ||
+      (passwordLength > 0 && passwordLength < 8)) {
+    sendReply(request, 400, "text/plain", "Invalid ssid or password");
+    return;
+  }
+  if (wifiConfigChanged) {
+    sendReply(request, 409, "text/plain", "Busy");
+    return;
+  }
+  
+  memset(&newWifiConfig, 0, sizeof(newWifiConfig));
+  strcpy(newWifiConfig.ssid, newSsid.c_str());
+  strcpy(newWifiConfig.password, newPassword);
+  wifiConfigChanged = true;
+  sendReply(request, 200, "text/plain", newSsid.length() ? "Joining network" : "Network forgotten");
+}
+
+// Reply to a control request depending on whether its command was accepted
+void sendQueued(AsyncWebServerRequest *request, bool queued, const char *message) {
+  if (queued) {
+    sendBuffer(request, 200, "text/plain", message);
+  } else {
+    sendReply(request, 400, "text/plain", "Invalid command");
+  }
+}
+
+void handleColor(AsyncWebServerRequest *request) {
+  if (request->hasParam("hex")) {
+    long hexColor = strtol(request->getParam("hex")->value().c_str(), NULL, 16);
+    sendQueued(request, queueCommand(CMD_COLOR, hexColor), "OK");
+  } else {
+    sendReply(request, 400, "text/plain", "Missing hex parameter");
+  }
+}
+
+void handleBrightness(AsyncWebServerRequest *request) {
+  if (request->hasParam("val")) {
+    int brightness = request->getParam("val")->value().toInt();
+    sendQueued(request, queueCommand(CMD_BRIGHTNESS, brightness), "OK");
+  } else {
+    sendReply(request, 400, "text/plain", "Missing val parameter");
+  }
+}
+
+void handleToggle(AsyncWebServerRequest *request) {
+  sendQueued(request, queuePowerToggle(), "Toggled");
+}
+
+void handleEffect(AsyncWebServerRequest *request) {
+  if (request->hasParam("id")) {
+    int effect = request->getParam("id")->value().toInt();
+    sendQueued(request, queueCommand(CMD_EFFECT, effect), "Effect started");
+  } else {
+    sendReply(request, 400, "text/plain", "Missing id parameter");
+  }
+}
+
+// ========== MUSIC CONTROL HANDLERS ==========
+void handleMusic(AsyncWebServerRequest *request) {
+  if (request->hasParam("file")) {
+    strlcpy(currentSongName, request->getParam("file")->value().c_str(), sizeof(currentSongName));
+    Serial.print("Music file selected: ");
+    Serial.println(currentSongName);
+    static char message[96];
+    snprintf(message, sizeof(message), "File received: %s", currentSongName);
+    sendBuffer(request, 200, "text/plain", message);
+  } 
+  else if (request->hasParam("cmd")) {
+    const String &cmd = request->getParam("cmd")->value();
+    if (cmd == "play") {
+      sendQueued(request, queueCommand(CMD_MUSIC_PLAY, 0), "Playing");
+    } 
+    else if (cmd == "stop") {
+      sendQueued(request, queueCommand(CMD_MUSIC_STOP, 0), "Stopped");
+    } 
+    else {
+      sendReply(request, 400, "text/plain", "Invalid command");
+    }
+  }
+  else if (request->hasParam("effect")) {
+    int effect = request->getParam("effect")->value().toInt();
+    sendQueued(request, queueCommand(CMD_MUSIC_EFFECT, effect), "Effect changed");
+  }
+  else if (request->hasParam("density")) {
+    int density = request->getParam("density")->value().toInt();
+    sendQueued(request, queueCommand(CMD_DENSITY, density), "Density set");
+  }
+  else if (request->hasParam("roughness")) {
+    int roughness = request->getParam("roughness")->value().toInt();
+    sendQueued(request, queueCommand(CMD_ROUGHNESS, roughness), "Roughness set");
+  }
+  else if (request->hasParam("effectSpeed")) {
+    int speed = request->getParam("effectSpeed")->value().toInt();
+    sendQueued(request, queueCommand(CMD_EFFECT_SPEED, speed), "Effect speed set");
+  }
+  else if (request->hasParam("glowingSpeed")) {
+    int speed = request->getParam("glowingSpeed")->value().toInt();
+    sendQueued(request, queueCommand(CMD_GLOWING_SPEED, speed), "Glowing speed set");
+  }
+  else {
+    sendReply(request, 400, "text/plain", "Invalid parameters");
+  }
+}
+
+// GET /audio shows the jitter buffer, /audio?latency=<ms> sets its
+// playout delay - raise it in rooms where audioLate keeps counting
+void handleAudio(AsyncWebServerRequest *request) {
+  if (request->hasParam("latency")) {
+    long latency = request->getParam("latency")->value().toInt();
+    if (latency < 0 || latency > AUDIO_LATENCY_MAX) {
+      sendReply(request, 400, "text/plain", "Invalid latency");
+      return;
+    }
+    audioLatencyTarget = latency;
+  }
+  static char message[256];
+  snprintf(message, sizeof(message),
+           "{\"latency\":%u,\"effective\":%lu,\"jitter\":%lu,\"jitterMax\":%lu,"
+           "\"frames\":%lu,\"lost\":%lu,\"late\":%lu,\"underruns\":%lu}",
+           (unsigned int)audioLatencyTarget, audioLatencyMicros / 1000, audioJitterMicros / 1000,
+           max(audioJitterMax, audioJitterPrevMax), audioFrames, audioLost, audioLate, audioUnderruns);
+  sendBuffer(request, 200, "application/json", message);
+}
+
+// ========== PRESET HANDLERS ==========
+// GET /preset                         used slots and their names as JSON
+// GET /preset?save=<n>[&name=<text>]  store the current settings in slot n
+// GET /preset?recall=<n>              apply slot n at the next frame
+// GET /preset?delete=<n>
+int8_t presetSlotParam(AsyncWebServerRequest *request, const char *name) {
+  const String &value = request->getParam(name)->value();
+  if (value.length() == 0 || value.length() > 2 || !isDigit(value[0])) return NO_PRESET;
+  long slot = value.toInt();
+  return (slot >= 0 && slot < PRESET_SLOTS) ? slot : NO_PRESET;
+}
+
+void handlePreset(AsyncWebServerRequest *request) {
+  const char *action = request->hasParam("save") ? "save" :
+                       request->hasParam("recall") ? "recall" :
+                       request->hasParam("delete") ? "delete" : NULL;
+  if (action) {
+    int8_t slot = presetSlotParam(request, action);
+    if (slot == NO_PRESET) {
+      sendReply(request, 400, "text/plain", "Invalid slot");
+      return;
+    }
+    if (action[0] == 's') {
+      // Keep the name printable inside the JSON list
+      const char *name = request->hasParam("name") ? request->getParam("name")->value().c_str() : "";
+      uint8_t len = 0;
+      for (; *name && len < PRESET_NAME_SIZE - 1; name++) {
+        if (*name >= ' ' && *name != '"' && *name != '\\') presetSaveName[len++] = *name;
+      }
+      presetSaveName[len] = 0;
+      presetSaveSlot = slot;
+      sendReply(request, 200, "text/plain", "Saving");
+    } else if (action[0] == 'd') {
+      presetDeleteSlot = slot;
+      sendReply(request, 200, "text/plain", "Deleting");
+    } else if (!(presetUsed & (1UL << slot))) {
+      sendReply(request, 404, "text/plain", "Empty slot");
+    } else {
+      presetRecallSlot = slot;
+      sendReply(request, 200, "text/plain", "Recalling");
+    }
+    return;
+  }
+  
+  static char json[PRESET_SLOTS * (PRESET_NAME_SIZE + 24) + 16];
+  size_t len = snprintf(json, sizeof(json), "{\"presets\":[");
+  PresetRecord record;
+  for (uint8_t slot = 0; slot < PRESET_SLOTS; slot++) {
+    if (!(presetUsed & (1UL << slot)) || !readPreset(slot, record)) continue;
+    len += snprintf(json + len, sizeof(json) - len, "%s{\"slot\":%u,\"name\":\"%.*s\"}",
+                    json[len - 1] == '[' ? "" : ",", (unsigned int)slot,
+                    PRESET_NAME_SIZE, record.name);
+  }
+  snprintf(json + len, sizeof(json) - len, "]}");
+  sendBuffer(request, 200, "application/json", json);
+}
+
+// ========== PLAYLIST HANDLERS ==========
+// GET /playlist                                  list and position as JSON
+// GET /playlist?set=e12:30,p3:60[&shuffle=1][&fade=<ms>]
+//     effect 12 for 30 s, then preset 3 for 60 s, ...
+// GET /playlist?start, ?stop, ?next
+bool parsePlaylist(const char *text, Playlist &list) {
+  list.count = 0;
+  while (*text) {
+    if (list.count == PLAYLIST_MAX_ENTRIES) return false;
+    PlaylistEntry &entry = list.entries[list.count++];
+    if (*text == 'e') entry.kind = PLAYLIST_EFFECT;
+    else if (*text == 'p') entry.kind = PLAYLIST_PRESET;
+    else return false;
+    
+    char *end;
+    long index = strtol(text + 1, &end, 10);
+    if (end == text + 1 || *end != ':') return false;
+    long seconds = strtol(end + 1, &end, 10);
+    if (*end && *end != ',') return false;
+    if (index < 0 || index >= (entry.kind == PLAYLIST_EFFECT ? 100 : PRESET_SLOTS)) return false;
+    if (seconds < PLAYLIST_MIN_SECONDS || seconds > 65535) return false;
+    entry.index = index;
+    entry.seconds = seconds;
+    text = *end ? end + 1 : end;
+  }
+  return list.count > 0;
+}
+
+// Seconds left of the current entry - 0 once it has run over (loop() was busy)
+unsigned long playlistRemaining() {
+  if (!playlistActive) return 0;
+  unsigned long length = playlist.entries[playlistOrder[playlistStep]].seconds * 1000UL;
+  unsigned long elapsed = millis() - playlistEntryStart;
+  return elapsed < length ? (length - elapsed) / 1000 : 0;
+}
+
+void handlePlaylist(AsyncWebServerRequest *request) {
+  if (request->hasParam("set")) {
+    if (playlistChanged) {
+      sendReply(request, 409, "text/plain", "Busy");
+      return;
+    }
+    long fade = request->hasParam("fade") ? request->getParam("fade")->value().toInt() : 0;
+    if (!parsePlaylist(request->getParam("set")->value().c_str(), newPlaylist) ||
+        fade < 0 || fade > PLAYLIST_MAX_FADE) {
+      sendReply(request, 400, "text/plain", "Invalid playlist");
+      return;
+    }
+    newPlaylist.magic = PLAYLIST_MAGIC;
+    newPlaylist.fadeMillis = fade;
+    newPlaylist.flags = 0;
+    if (request->hasParam("shuffle") && request->getParam("shuffle")->value() == "1") {
+      newPlaylist.flags |= PLAYLIST_FLAG_SHUFFLE;
+    }
+    playlistChanged = true;
+    sendReply(request, 200, "text/plain", "Playlist saved");
+    return;
+  }
+  if (request->hasParam("start")) playlistCommand = PLAYLIST_START;
+  else if (request->hasParam("stop")) playlistCommand = PLAYLIST_STOP;
+  else if (request->hasParam("next")) playlistCommand = PLAYLIST_NEXT;
+  if (playlistCommand != PLAYLIST_NONE) {
+    sendReply(request, 200, "text/plain", "OK");
+    return;
+  }
+  
+  static char json[PLAYLIST_MAX_ENTRIES * 12 + 160];
+  size_t len = snprintf(json, sizeof(json), "{\"active\":%s,\"shuffle\":%s,\"fade\":%u,\"step\":%u,"
+                        "\"remaining\":%lu,\"entries\":\"",
+                        playlistActive ? "true" : "false",
+                        (playlist.flags & PLAYLIST_FLAG_SHUFFLE) ? "true" : "false",
+                        (unsigned int)playlist.fadeMillis, (unsigned int)playlistStep,
+                        playlistRemaining());
+  for (uint8_t i = 0; i < playlist.count && len < sizeof(json); i++) {
+    const PlaylistEntry &entry = playlist.entries[i];
+    len += snprintf(json + len, sizeof(json) - len, "%s%c%u:%u", i ? "," : "",
+                    entry.kind == PLAYLIST_PRESET ? 'p' : 'e',
+                    (unsigned int)entry.index, (unsigned int)entry.seconds);
+  }
+  if (len < sizeof(json)) snprintf(json + len, sizeof(json) - len, "\"}");
+  sendBuffer(request, 200, "application/json", json);
+}
+
+// ========== SCHEDULE HANDLERS ==========
+// GET /time?epoch=<UTC seconds>&tz=<minutes east of UTC>   set by the page
+// GET /schedule                       clock, circadian and rules as JSON
+// GET /schedule?set=22:30/dim/20/30,07:00/sunrise/255/30,01:00/off/0/10
+//     at HH:MM, action (dim, sunrise, off, on), brightness, ramp minutes;
+//     an empty set clears the rules
+// GET /schedule?circadian=0|1         white effects follow the time of day
+void handleTime(AsyncWebServerRequest *request) {
+  if (!request->hasParam("epoch")) {
+    sendReply(request, 400, "text/plain", "Missing epoch");
+    return;
+  }
+  uint32_t epoch = strtoul(request->getParam("epoch")->value().c_str(), NULL, 10);
+  long tz = request->hasParam("tz") ? request->getParam("tz")->value().toInt() : 0;
+  if (epoch < CLOCK_VALID_EPOCH || tz < -720 || tz > 840) {
+    sendReply(request, 400, "text/plain", "Invalid time");
+    return;
+  }
+  pageClockTz = tz;
+  pageClockEpoch = epoch;
+  sendReply(request, 200, "text/plain", "OK");
+}
+
+bool parseSchedule(const char *text, Schedule &s) {
+  s.count = 0;
+  while (*text) {
+    if (s.count == SCHEDULE_MAX_RULES) return false;
+    ScheduleRule &rule = s.rules[s.count++];
+    
+    char *end;
+    long hour = strtol(text, &end, 10);
+    if (end == text || *end != ':') return false;
+    long minute = strtol(end + 1, &end, 10);
+    if (*end != '/' || hour < 0 || hour > 23 || minute < 0 || minute > 59) return false;
+    text = end + 1;
+    
+    uint8_t action = 0;
+    while (action < 4) {
+      size_t len = strlen(scheduleActionNames[action]);
+      if (strncmp(text, scheduleActionNames[action], len) == 0 && text[len] == '/') break;
+      action++;
+    }
+    if (action == 4) return false;
+    text += strlen(scheduleActionNames[action]) + 1;
+    
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != '/') return false;
+    long minutes = strtol(end + 1, &end, 10);
+    if (*end && *end != ',') return false;
+    if (value < 0 || value > 255 || minutes < 0 || minutes > SCHEDULE_MAX_MINUTES) return false;
+    if (action == SCHEDULE_SUNRISE && value == 0) return false; // A sunrise to dark
+    
+    rule.minute = hour * 60 + minute;
+    rule.action = action;
+    rule.value = value;
+    rule.minutes = minutes;
+    text = *end ? end + 1 : end;
+  }
+  return true;
+}
+
+void handleSchedule(AsyncWebServerRequest *request) {
+  bool set = request->hasParam("set");
+  bool circadian = request->hasParam("circadian");
+  if (set || circadian) {
+    if (scheduleChanged) {
+      sendReply(request, 409, "text/plain", "Busy");
+      return;
+    }
+    memcpy(&newSchedule, &schedule, sizeof(newSchedule));
+    if (set && !parseSchedule(request->getParam("set")->value().c_str(), newSchedule)) {
+      sendReply(request, 400, "text/plain", "Invalid schedule");
+      return;
+    }
+    if (circadian) newSchedule.circadian = request->getParam("circadian")->value() == "1";
+    scheduleChanged = true;
+    sendReply(request, 200, "text/plain", "Schedule saved");
+    return;
+  }
+  
+  static char json[SCHEDULE_MAX_RULES * 24 + 160];
+  uint32_t second = clockSource == CLOCK_NONE ? 0 : localSecondOfDay();
+  size_t len = snprintf(json, sizeof(json), "{\"time\":\"%02u:%02u:%02u\",\"clock\":\"%s\",\"tz\":%d,"
+                        "\"circadian\":%s,\"kelvin\":%u,\"ramp\":%s,\"rules\":\"",
+                        (unsigned int)(second / 3600), (unsigned int)(second / 60 % 60),
+                        (unsigned int)(second % 60),
+                        clockSource == CLOCK_NTP ? "ntp" : clockSource == CLOCK_PAGE ? "page" : "none",
+                        (int)schedule.tzMinutes, schedule.circadian ? "true" : "false",
+                        (unsigned int)currentKelvin, rampActive ? "true" : "false");
+  for (uint8_t i = 0; i < schedule.count && len < sizeof(json); i++) {
+    const ScheduleRule &rule = schedule.rules[i];
+    len += snprintf(json + len, sizeof(json) - len, "%s%02u:%02u/%s/%u/%u", i ? "," : "",
+                    (unsigned int)(rule.minute / 60), (unsigned int)(rule.minute % 60),
+                    scheduleActionNames[rule.action], (unsigned int)rule.value,
+                    (unsigned int)rule.minutes);
+  }
+  if (len < sizeof(json)) snprintf(json + len, sizeof(json) - len, "\"}");
+  sendBuffer(request, 200, "application/json", json);
+}
+
+// ========== TOUCH GESTURE HANDLERS ==========
+// GET /touch                          what each gesture does, as JSON
+// GET /touch?tap=next&double=power&triple=previous&hold=dim
+//     any of tap, double, triple, hold; actions none, next, previous,
+//     power, dim, playlist, preset<n> (recall slot n)
+void handleTouch(AsyncWebServerRequest *request) {
+  bool changed = false;
+  for (uint8_t gesture = 0; gesture < TOUCH_GESTURES; gesture++) {
+    changed |= request->hasParam(touchGestureNames[gesture]);
+  }
+  if (changed) {
+    // loop() has not saved the last mapping yet - leave it alone
+    if (touchMapChanged) {
+      sendReply(request, 409, "text/plain", "Busy");
+      return;
+    }
+    TouchMap map;
+    memcpy(&map, &touchMap, sizeof(map));
+    for (uint8_t gesture = 0; gesture < TOUCH_GESTURES; gesture++) {
+      if (!request->hasParam(touchGestureNames[gesture])) continue;
+      const char *value = request->getParam(touchGestureNames[gesture])->value().c_str();
+      uint8_t action = TOUCH_NONE;
+      while (action < TOUCH_PRESET && strcmp(value, touchActionNames[action]) != 0) action++;
+      long slot = 0;
+      if (action == TOUCH_PRESET) {
+        // preset<n> - the prefix and a digit first, so the parse stays inside the string
+        char *end = NULL;
+        bool valid = strncmp(value, "preset", 6) == 0 && isDigit(value[6]);
+        if (valid) slot = strtol(value + 6, &end, 10);
+        if (!valid || *end || slot >= PRESET_SLOTS) {
+          sendReply(request, 400, "text/plain", "Invalid action");
+          return;
+        }
+      }
+      map.action[gesture] = action;
+      map.param[gesture] = slot;
+    }
+    memcpy(&newTouchMap, &map, sizeof(newTouchMap));
+    touchMapChanged = true;
+    sendReply(request, 200, "text/plain", "Gestures saved");
+    return;
+  }
+  
+  static char json[TOUCH_GESTURES * 24 + 16];
+  size_t len = snprintf(json, sizeof(json), "{");
+  for (uint8_t gesture = 0; gesture < TOUCH_GESTURES; gesture++) {
+    uint8_t action = touchMap.action[gesture];
+    len += snprintf(json + len, sizeof(json) - len, "%s\"%s\":\"%s", gesture ? "," : "",
+                    touchGestureNames[gesture], touchActionNames[action]);
+    if (action == TOUCH_PRESET) {
+      len += snprintf(json + len, sizeof(json) - len, "%u", (unsigned int)touchMap.param[gesture]);
+    }
+    len += snprintf(json + len, sizeof(json) - len, "\"");
+  }
+  snprintf(json + len, sizeof(json) - len, "}");
+  sendBuffer(request, 200, "application/json", json);
+}
+
+// ========== MUSIC TIMELINE HANDLERS ==========
+// GET /timeline                      name, length and state of the timeline
+// GET /timeline?play=<ms>[&in=<ms>]  be at song position <ms> after <in> ms
+// GET /timeline?stop=1
+// POST /timeline                     upload a timeline file (raw body)
+File timelineUpload;
+AsyncWebServerRequest *timelineUploader = NULL;
+bool timelineUploadFailed = false;
+
+void handleTimelineInfo(AsyncWebServerRequest *request) {
+  if (request->hasParam("stop")) {
+    requestTimeline(TIMELINE_STOP, 0);
+    sendReply(request, 200, "text/plain", "Stopped");
+    return;
+  }
+  if (request->hasParam("play")) {
+    if (!timelineValid) {
+      sendReply(request, 404, "text/plain", "No timeline uploaded");
+      return;
+    }
+    uint32_t delayMs = request->hasParam("in") ? request->getParam("in")->value().toInt() : 0;
+    requestTimeline(request->getParam("play")->value().toInt(), delayMs);
+    sendReply(request, 200, "text/plain", "Playing");
+    return;
+  }
+  
+  // Only what loop() and setup() cached - no flash reads from here
+  static char message[160];
+  snprintf(message, sizeof(message),
+           "{\"name\":\"%s\",\"frames\":%lu,\"frameMs\":%u,\"bpm\":%u,\"playing\":%s}",
+           timelineValid ? timelineHeader.name : "",
+           timelineValid ? (unsigned long)timelineHeader.frameCount : 0UL,
+           timelineValid ? timelineHeader.frameMs : 0,
+           timelineValid ? 60000 / timelineHeader.beatPeriod : 0,
+           timelinePlaying ? "true" : "false");
+  sendBuffer(request, 200, "application/json", message);
+}
 
-// ========== STABILITY FUNCTIONS ==========
-void checkStack() {
-  // Check if stack canary is still intact
-  if (stackCanary != STACK_CANARY) {
-    Serial.println("STACK OVERFLOW DETECTED! Resetting...");
-    ESP.reset();
+void finishTimelineUpload(bool keep) {
+  timelineUpload.close();
+  if (keep) {
+    LittleFS.remove(TIMELINE_FILE);
+    LittleFS.rename(TIMELINE_UPLOAD_FILE, TIMELINE_FILE);
+  } else {
+    LittleFS.remove(TIMELINE_UPLOAD_FILE);
   }
+  timelineUploader = NULL;
+  micPaused = false;
 }
 
-void feedWatchdog() {
-  // Feed the watchdog timer
-  ESP.wdtFeed();
+// The body is written to flash as it arrives, then swapped in once complete
+void handleTimelineBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                        size_t index, size_t total) {
+  if (index == 0) {
+    if (timelineUploader) finishTimelineUpload(false); // A newer upload wins
+    
+    // Playback stops and the microphone pauses while flash is written
+    micPaused = true;
+    stopMicSampler();
+    closeTimeline();
+    
+    FSInfo info;
+    LittleFS.info(info);
+    timelineUploader = request;
+    timelineUploadFailed = total < sizeof(TimelineHeader) ||
+                           total > info.totalBytes - info.usedBytes;
+    if (!timelineUploadFailed) {
+      timelineUpload = LittleFS.open(TIMELINE_UPLOAD_FILE, "w");
+      timelineUploadFailed = !timelineUpload;
+    }
+    request->onDisconnect([request]() {
+      if (timelineUploader == request) finishTimelineUpload(false);
+    });
+  } else if (timelineUploader != request) {
+    return;
+  }
+  
+  if (!timelineUploadFailed && timelineUpload.write(data, len) != len) {
+    timelineUploadFailed = true;
+  }
 }
 
-// ========== TOUCH SENSOR FUNCTIONS ==========
-void handleTouchSensor() {
-  // Read touch sensor state
-  currentTouchState = (digitalRead(TOUCH_SENSOR_PIN) == LOW); // Assuming active LOW
+void handleTimelineUpload(AsyncWebServerRequest *request) {
+  if (timelineUploader != request) {
+    sendReply(request, timelineUploader ? 409 : 400, "text/plain",
+                  timelineUploader ? "Busy" : "Missing timeline");
+    return;
+  }
   
-  unsigned long currentMillis = millis();
+  bool failed = timelineUploadFailed;
+  finishTimelineUpload(!failed);
+  if (failed || !openTimeline()) {
+    LittleFS.remove(TIMELINE_FILE);
+    sendReply(request, 400, "text/plain", "Invalid timeline or not enough space");
+    return;
+  }
+  handleTimelineInfo(request);
+}
+
+// ========== BULK STATE API ==========
+// GET /state returns every setting as one JSON object. POST /state takes a
+// whole or partial object with the same keys (or binary commands in the
+// WebSocket format) and applies all of it in the same frame, e.g.
+//   {"color":"#FF8800","brightness":200,"effect":12,"density":70}
+// The JSON parser works byte by byte on the body chunks as they arrive and
+// never allocates.
+#define STATE_KEY_SIZE 16
+#define STATE_TOKEN_SIZE 12
+
+struct StateField {
+  const char *name;
+  uint8_t type;
+};
+
+const StateField stateFields[] = {
+  {"color", CMD_COLOR},
+  {"brightness", CMD_BRIGHTNESS},
+  {"power", CMD_POWER},
+  {"effect", CMD_EFFECT},
+  {"musicPlaying", CMD_MUSIC_PLAY},
+  {"musicEffect", CMD_MUSIC_EFFECT},
+  {"density", CMD_DENSITY},
+  {"roughness", CMD_ROUGHNESS},
+  {"effectSpeed", CMD_EFFECT_SPEED},
+  {"glowingSpeed", CMD_GLOWING_SPEED}
+};
+
+enum StateParserState : uint8_t {
+  PARSE_OBJECT_START,
+  PARSE_KEY_OR_END,
+  PARSE_KEY,
+  PARSE_COLON,
+  PARSE_VALUE,
+  PARSE_STRING_VALUE,
+  PARSE_BARE_VALUE,   // Number, true, false or null
+  PARSE_COMMA_OR_END,
+  PARSE_DONE,
+  PARSE_ERROR
+};
+
+struct StateParser {
+  AsyncWebServerRequest *owner; // Request whose body is being parsed
+  uint8_t state;
+  char key[STATE_KEY_SIZE];
+  uint8_t keyLength;
+  char token[STATE_TOKEN_SIZE];
+  uint8_t tokenLength;
+  bool skipValue;                // Value of an unknown key - read past, not kept
+  bool escape;                   // Last string character was a backslash
+  uint16_t mask;                 // Bit per CommandType found in the document
+  int32_t values[COMMAND_TYPES];
+};
+
+StateParser stateParser;
+
+void resetStateParser(AsyncWebServerRequest *owner) {
+  stateParser.owner = owner;
+  stateParser.state = PARSE_OBJECT_START;
+  stateParser.keyLength = 0;
+  stateParser.tokenLength = 0;
+  stateParser.mask = 0;
   
-  // Detect touch press (falling edge)
-  if (currentTouchState && !lastTouchState) {
-    touchStartTime = currentMillis;
-    touchActive = true;
-    longPressDetected = false;
-    Serial.println("Touch pressed");
+  // A dropped upload must not keep the parser - a later request could even
+  // be allocated at the same address
+  owner->onDisconnect([owner]() {
+    if (stateParser.owner == owner) stateParser.owner = NULL;
+  });
+}
+
+bool stateKeyKnown() {
+  StateParser &p = stateParser;
+  p.key[p.keyLength] = '\0';
+  for (uint8_t i = 0; i < sizeof(stateFields) / sizeof(stateFields[0]); i++) {
+    if (strcmp(p.key, stateFields[i].name) == 0) return true;
   }
+  return false;
+}
+
+// Store the value just read for the current key; unknown keys are ignored
+bool storeStateValue(bool isString) {
+  StateParser &p = stateParser;
+  p.key[p.keyLength] = '\0';
+  p.token[p.tokenLength] = '\0';
   
-  // Detect touch release (rising edge)
-  if (!currentTouchState && lastTouchState) {
-    touchActive = false;
-    unsigned long pressDuration = currentMillis - touchStartTime;
+  for (uint8_t i = 0; i < sizeof(stateFields) / sizeof(stateFields[0]); i++) {
+    if (strcmp(p.key, stateFields[i].name) != 0) continue;
     
-    // Short press: Change effect
-    if (pressDuration < LONG_PRESS_TIME && !longPressDetected) {
-      touchMode = true; // Switch to touch control mode
-      
-      // Cycle to next effect
-      touchEffectIndex++;
-      if (touchEffectIndex >= 100) { // 100 total effects
-        touchEffectIndex = 0;
-      }
-      
-      // Set the effect
-      currentEffect = touchEffectIndex;
-      isEffectRunning = true;
-      effectCounter = 0;
-      effectPosition = 0;
-      hueCounter = 0;
-      
-      Serial.print("Touch: Changed to effect ");
-      Serial.println(touchEffectIndex);
-      
-      // Visual feedback - blink once
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip.setPixelColor(i, strip.Color(255, 255, 255));
-      }
-      strip.show();
-      delay(50);
+    uint8_t type = stateFields[i].type;
+    int32_t value;
+    if (type == CMD_COLOR) {
+      if (!isString) return false;
+      value = strtol(p.token[0] == '#' ? p.token + 1 : p.token, NULL, 16);
+    } else if (isString) {
+      return false;
+    } else if (strcmp(p.token, "true") == 0) {
+      value = 1;
+    } else if (strcmp(p.token, "false") == 0) {
+      value = 0;
+    } else if (strcmp(p.token, "null") == 0) {
+      return true; // Leave the setting unchanged
+    } else {
+      char *end;
+      value = strtol(p.token, &end, 10);
+      if (end == p.token || *end != '\0') return false;
     }
+    
+    if (type == CMD_MUSIC_PLAY && value == 0) type = CMD_MUSIC_STOP;
+    p.values[type] = value;
+    p.mask |= (1 << type);
+    return true;
   }
+  return true;
+}
+
+// Feed the next chunk of a flat JSON object to the parser
+void feedStateParser(const uint8_t *data, size_t len) {
+  StateParser &p = stateParser;
   
-  // Detect long press while still touching
-  if (touchActive && !longPressDetected) {
-    unsigned long pressDuration = currentMillis - touchStartTime;
-    if (pressDuration >= LONG_PRESS_TIME) {
-      longPressDetected = true;
-      
-      // Long press: Toggle power
-      isPoweredOn = !isPoweredOn;
-      touchMode = true; // Switch to touch control mode
-      
-      if (!isPoweredOn) {
-        // Turn off all LEDs
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip.setPixelColor(i, 0);
+  for (size_t i = 0; i < len && p.state != PARSE_ERROR; i++) {
+    char c = data[i];
+    bool space = (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    
+    switch (p.state) {
+      case PARSE_OBJECT_START:
+        if (c == '{') p.state = PARSE_KEY_OR_END;
+        else if (!space) p.state = PARSE_ERROR;
+        break;
+        
+      case PARSE_KEY_OR_END:
+        if (c == '"') {
+          p.keyLength = 0;
+          p.state = PARSE_KEY;
+        } else if (c == '}') {
+          p.state = PARSE_DONE;
+        } else if (!space) {
+          p.state = PARSE_ERROR;
         }
-        isEffectRunning = false;
-      } else {
-        // Turn on with current effect
-        isEffectRunning = true;
+        break;
         
-        // Visual feedback - blink twice
-        for (int j = 0; j < 2; j++) {
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip.setPixelColor(i, strip.Color(255, 255, 255));
-          }
-          strip.show();
-          delay(50);
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip.setPixelColor(i, 0);
+      case PARSE_KEY:
+        // Over-long keys are truncated - they cannot match a known field
+        if (c == '"') p.state = PARSE_COLON;
+        else if (p.keyLength < STATE_KEY_SIZE - 1) p.key[p.keyLength++] = c;
+        break;
+        
+      case PARSE_COLON:
+        if (c == ':') p.state = PARSE_VALUE;
+        else if (!space) p.state = PARSE_ERROR;
+        break;
+        
+      case PARSE_VALUE:
+        p.tokenLength = 0;
+        p.skipValue = !stateKeyKnown();
+        p.escape = false;
+        if (c == '"') {
+          p.state = PARSE_STRING_VALUE;
+        } else if (c == '-' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')) {
+          if (!p.skipValue) p.token[p.tokenLength++] = c;
+          p.state = PARSE_BARE_VALUE;
+        } else if (!space) {
+          p.state = PARSE_ERROR; // Nested objects and arrays are not supported
+        }
+        break;
+        
+      case PARSE_STRING_VALUE:
+        if (p.escape) {
+          p.escape = false; // Escaped character - kept as it is, never the end
+          if (p.skipValue) break;
+        } else if (c == '\\') {
+          p.escape = true;
+          if (p.skipValue) break;
+        } else if (c == '"') {
+          p.state = (p.skipValue || storeStateValue(true)) ? PARSE_COMMA_OR_END : PARSE_ERROR;
+          break;
+        } else if (p.skipValue) {
+          break; // Unknown keys may hold strings of any length
+        }
+        if (p.tokenLength < STATE_TOKEN_SIZE - 1) {
+          p.token[p.tokenLength++] = c;
+        } else {
+          p.state = PARSE_ERROR;
+        }
+        break;
+        
+      case PARSE_BARE_VALUE:
+        if (c == ',' || c == '}' || space) {
+          if (!p.skipValue && !storeStateValue(false)) {
+            p.state = PARSE_ERROR;
+          } else if (c == ',') {
+            p.state = PARSE_KEY_OR_END;
+          } else if (c == '}') {
+            p.state = PARSE_DONE;
+          } else {
+            p.state = PARSE_COMMA_OR_END;
           }
-          strip.show();
-          delay(50);
+        } else if (p.skipValue) {
+          // Unknown key - any length
+        } else if (p.tokenLength < STATE_TOKEN_SIZE - 1) {
+          p.token[p.tokenLength++] = c;
+        } else {
+          p.state = PARSE_ERROR;
         }
-      }
-      
-      strip.show();
-      Serial.print("Touch: Power ");
-      Serial.println(isPoweredOn ? "ON" : "OFF");
+        break;
+        
+      case PARSE_COMMA_OR_END:
+        if (c == ',') p.state = PARSE_KEY_OR_END;
+        else if (c == '}') p.state = PARSE_DONE;
+        else if (!space) p.state = PARSE_ERROR;
+        break;
+        
+      case PARSE_DONE:
+        if (!space) p.state = PARSE_ERROR; // Trailing garbage
+        break;
     }
   }
-  
-  // Update last touch state
-  lastTouchState = currentTouchState;
-}
-
-// Handle web requests
-void handleRoot() {
-  webServer.send(200, "text/html", index_html);
 }
 
-void handleColor() {
-  if (webServer.hasArg("hex")) {
-    String hexStr = webServer.arg("hex");
-    long hexColor = strtol(hexStr.c_str(), NULL, 16);
-    
-    int r = (hexColor >> 16) & 0xFF;
-    int g = (hexColor >> 8) & 0xFF;
-    int b = hexColor & 0xFF;
-    
-    currentColor = strip.Color(r, g, b);
-    
-    // Stop any running effect
-    isEffectRunning = false;
-    touchMode = false; // Switch back to web control mode
-    
-    // Set all LEDs to the selected color
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip.setPixelColor(i, currentColor);
+// Read binary commands (same format as the WebSocket) into the parser
+void parseBinaryState(const uint8_t *data, size_t len) {
+  StateParser &p = stateParser;
+  size_t pos = 0;
+  
+  while (pos < len) {
+    uint8_t type = data[pos++];
+    int size = commandPayloadSize(type);
+    if (size < 0 || type >= COMMAND_TYPES || pos + size > len) {
+      p.state = PARSE_ERROR;
+      return;
     }
-    strip.setBrightness(currentBrightness);
-    strip.show();
     
-    Serial.print("Color set: R=");
-    Serial.print(r);
-    Serial.print(" G=");
-    Serial.print(g);
-    Serial.print(" B=");
-    Serial.println(b);
+    int32_t value = 0;
+    if (type == CMD_COLOR) {
+      value = ((int32_t)data[pos] << 16) | ((int32_t)data[pos + 1] << 8) | data[pos + 2];
+    } else if (size == 1) {
+      value = data[pos];
+    }
+    pos += size;
     
-    webServer.send(200, "text/plain", "OK");
-  } else {
-    webServer.send(400, "text/plain", "Missing hex parameter");
+    p.values[type] = value;
+    p.mask |= (1 << type);
   }
+  p.state = PARSE_DONE;
 }
 
-void handleBrightness() {
-  if (webServer.hasArg("val")) {
-    currentBrightness = webServer.arg("val").toInt();
-    strip.setBrightness(currentBrightness);
-    strip.show();
-    
-    Serial.print("Brightness set to: ");
-    Serial.println(currentBrightness);
-    
-    webServer.send(200, "text/plain", "OK");
-  } else {
-    webServer.send(400, "text/plain", "Missing val parameter");
+void handleStateBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                     size_t index, size_t total) {
+  if (index == 0) {
+    resetStateParser(request);
+    if (len > 0 && data[0] != '{' && len == total) {
+      parseBinaryState(data, len);
+      return;
+    }
+  } else if (stateParser.owner != request) {
+    return; // Another request took over the parser
   }
+  feedStateParser(data, len);
 }
 
-void handleToggle() {
-  isPoweredOn = !isPoweredOn;
-  touchMode = false; // Switch back to web control mode
-  
-  if (!isPoweredOn) {
-    // Turn off all LEDs
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip.setPixelColor(i, 0);
-    }
-    isEffectRunning = false;
-  } else {
-    // Turn on with current color
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip.setPixelColor(i, currentColor);
+void handleGetState(AsyncWebServerRequest *request) {
+  static char json[256];
+  snprintf(json, sizeof(json),
+           "{\"power\":%s,\"brightness\":%d,\"color\":\"#%06lX\",\"effect\":%d,"
+           "\"effectRunning\":%s,\"musicPlaying\":%s,\"musicEffect\":%d,\"density\":%d,"
+           "\"roughness\":%d,\"effectSpeed\":%d,\"glowingSpeed\":%d}",
+           isPoweredOn ? "true" : "false", currentBrightness,
+           (unsigned long)(currentColor & 0xFFFFFF), currentEffect,
+           isEffectRunning ? "true" : "false", musicPlaying ? "true" : "false",
+           currentMusicEffect, musicDensity, musicRoughness, effectSpeed, glowingSpeed);
+  sendBuffer(request, 200, "application/json", json);
+}
+
+void handlePostState(AsyncWebServerRequest *request) {
+  if (stateParser.owner != request) {
+    if (stateParser.owner) {
+      sendReply(request, 409, "text/plain", "Busy"); // Another body is being parsed
+    } else {
+      sendReply(request, 400, "text/plain", "Missing state document");
     }
+    return;
   }
-  strip.show();
+  stateParser.owner = NULL;
   
-  Serial.print("Power toggled: ");
-  Serial.println(isPoweredOn ? "ON" : "OFF");
+  if (stateParser.state != PARSE_DONE) {
+    sendReply(request, 400, "text/plain", "Invalid state document");
+    return;
+  }
   
-  webServer.send(200, "text/plain", isPoweredOn ? "ON" : "OFF");
+  // Everything is queued from this one callback, so it lands in one frame
+  for (uint8_t type = 0; type < COMMAND_TYPES; type++) {
+    if (stateParser.mask & (1 << type)) {
+      queueCommand(type, stateParser.values[type]);
+    }
+  }
+  sendReply(request, 200, "text/plain", "OK");
 }
 
-void handleEffect() {
-  if (webServer.hasArg("id")) {
-    currentEffect = webServer.arg("id").toInt();
-    isEffectRunning = true;
-    touchMode = false; // Switch back to web control mode
-    effectCounter = 0;
-    effectPosition = 0;
-    hueCounter = 0;
-    
-    Serial.print("Effect started: ");
-    Serial.println(currentEffect);
-    
-    webServer.send(200, "text/plain", "Effect started");
-  } else {
-    webServer.send(400, "text/plain", "Missing id parameter");
+// /density, /roughness, /effectSpeed and /glowingSpeed?val=N from the sliders
+void handleMusicSlider(AsyncWebServerRequest *request) {
+  if (!request->hasParam("val")) {
+    handleMusic(request); // Older /music style arguments
+    return;
   }
+  
+  const String &url = request->url();
+  uint8_t type;
+  if (url == "/density") type = CMD_DENSITY;
+  else if (url == "/roughness") type = CMD_ROUGHNESS;
+  else if (url == "/effectSpeed") type = CMD_EFFECT_SPEED;
+  else type = CMD_GLOWING_SPEED;
+  
+  int value = request->getParam("val")->value().toInt();
+  sendQueued(request, queueCommand(type, value), "OK");
 }
 
-// ========== MUSIC CONTROL HANDLERS ==========
-void handleMusic() {
-  if (webServer.hasArg("file")) {
-    currentSongName = webServer.arg("file");
-    Serial.print("Music file selected: ");
-    Serial.println(currentSongName);
-    webServer.send(200, "text/plain", "File received: " + currentSongName);
-  } 
-  else if (webServer.hasArg("cmd")) {
-    String cmd = webServer.arg("cmd");
-    if (cmd == "play") {
-      musicPlaying = true;
-      musicEffectCounter = 0;
-      musicEffectPosition = 0;
-      Serial.println("Music playback started");
-      webServer.send(200, "text/plain", "Playing");
-    } 
-    else if (cmd == "stop") {
-      musicPlaying = false;
-      // Clear LEDs when music stops
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip.setPixelColor(i, 0);
-      }
-      strip.show();
-      Serial.println("Music playback stopped");
-      webServer.send(200, "text/plain", "Stopped");
-    } 
-    else {
-      webServer.send(400, "text/plain", "Invalid command");
-    }
-  }
-  else if (webServer.hasArg("effect")) {
-    currentMusicEffect = webServer.arg("effect").toInt();
-    Serial.print("Music effect changed to: ");
-    Serial.println(currentMusicEffect);
-    webServer.send(200, "text/plain", "Effect changed");
-  }
-  else if (webServer.hasArg("density")) {
-    musicDensity = webServer.arg("density").toInt();
-    Serial.print("Density set to: ");
-    Serial.println(musicDensity);
-    webServer.send(200, "text/plain", "Density set");
-  }
-  else if (webServer.hasArg("roughness")) {
-    musicRoughness = webServer.arg("roughness").toInt();
-    Serial.print("Roughness set to: ");
-    Serial.println(musicRoughness);
-    webServer.send(200, "text/plain", "Roughness set");
-  }
-  else if (webServer.hasArg("effectSpeed")) {
-    effectSpeed = webServer.arg("effectSpeed").toInt();
-    Serial.print("Effect speed set to: ");
-    Serial.println(effectSpeed);
-    webServer.send(200, "text/plain", "Effect speed set");
-  }
-  else if (webServer.hasArg("glowingSpeed")) {
-    glowingSpeed = webServer.arg("glowingSpeed").toInt();
-    Serial.print("Glowing speed set to: ");
-    Serial.println(glowingSpeed);
-    webServer.send(200, "text/plain", "Glowing speed set");
-  }
-  else {
-    webServer.send(400, "text/plain", "Invalid parameters");
-  }
+// ========== CAPTIVE PORTAL ==========
+// The DNS server answers every name with apIP, so the phone's "is there
+// internet?" probe lands here. Answering it with a redirect to the UI makes
+// the phone open the page by itself instead of retrying the probe.
+const char portalUrl[] PROGMEM = "http://192.168.4.1/";
+
+const char *const captiveProbePaths[] = {
+  "/generate_204",                // Android
+  "/gen_204",                     // Android
+  "/hotspot-detect.html",         // Apple
+  "/library/test/success.html",   // Apple
+  "/connecttest.txt",             // Windows
+  "/ncsi.txt",                    // Windows
+  "/redirect",                    // Windows
+  "/success.txt",                 // Firefox
+  "/canonical.html"               // Firefox
+};
+
+void sendPortalRedirect(AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response = request->beginResponse(302);
+  response->addHeader("Location", FPSTR(portalUrl));
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
-void handleNotFound() {
-  String message = "File Not Found\n\n";
-  message += "URI: ";
-  message += webServer.uri();
-  message += "\nMethod: ";
-  message += (webServer.method() == HTTP_GET) ? "GET" : "POST";
-  message += "\nArguments: ";
-  message += webServer.args();
-  message += "\n";
+void handleCaptiveProbe(AsyncWebServerRequest *request) {
+  sendPortalRedirect(request);
+}
+
+// Browsers ask for this on every page - an empty answer stops the retries
+void handleFavicon(AsyncWebServerRequest *request) {
+  request->send(204);
+}
+
+void handleNotFound(AsyncWebServerRequest *request) {
+  // Requests for other hosts are captive-portal checks we don't know yet
+  IPAddress host;
+  if (wifiState != WIFI_STATE_STATION &&
+      (!host.fromString(request->host().c_str()) || (uint32_t)host != (uint32_t)WiFi.softAPIP())) {
+    sendPortalRedirect(request);
+    return;
+  }
+  
+  // Static to keep it off the small system stack - sendBuffer() copies it
+  static char message[512];
+  size_t length = snprintf(message, sizeof(message),
+                           "File Not Found\n\nURI: %s\nMethod: %s\nArguments: %u\n",
+                           request->url().c_str(), (request->method() == HTTP_GET) ? "GET" : "POST",
+                           (unsigned int)request->params());
   
-  for (uint8_t i = 0; i < webServer.args(); i++) {
-    message += " " + webServer.argName(i) + ": " + webServer.arg(i) + "\n";
+  for (size_t i = 0; i < request->params() && length < sizeof(message); i++) {
+    AsyncWebParameter *param = request->getParam(i);
+    length += snprintf(message + length, sizeof(message) - length, " %s: %s\n",
+                       param->name().c_str(), param->value().c_str());
   }
   
-  webServer.send(404, "text/plain", message);
+  sendBuffer(request, 404, "text/plain", message);
 }
 
 // Utility functions
@@ -1734,8 +6025,7 @@ void effect0() {
 
 // Effect 1: Rainbow
 void effect1() {
-  if (millis() - lastEffectUpdate > 20) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(20)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + effectCounter) & 255));
     }
@@ -1747,8 +6037,7 @@ void effect1() {
 
 // Effect 2: Rainbow Cycle
 void effect2() {
-  if (millis() - lastEffectUpdate > 20) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(20)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel(((i * 85) + effectCounter) & 255));
     }
@@ -1760,8 +6049,7 @@ void effect2() {
 
 // Effect 3: Color Wipe
 void effect3() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     strip.setPixelColor(effectPosition, currentColor);
     strip.show();
     effectPosition++;
@@ -1776,8 +6064,7 @@ void effect3() {
 
 // Effect 4: Theater Chase
 void effect4() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectPosition) % 2 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -1793,8 +6080,7 @@ void effect4() {
 
 // Effect 5: Blink
 void effect5() {
-  if (millis() - lastEffectUpdate > 500) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(500)) {
     if (effectCounter % 2 == 0) {
       for (int i = 0; i < NUM_LEDS; i++) {
         strip.setPixelColor(i, currentColor);
@@ -1811,8 +6097,7 @@ void effect5() {
 
 // Effect 6: Running Lights
 void effect6() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int brightness = sin8((i * 85 + effectCounter)) / 2;
       strip.setPixelColor(i, strip.Color(
@@ -1829,8 +6114,7 @@ void effect6() {
 
 // Effect 7: Meteor
 void effect7() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Fade all LEDs
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -1859,8 +6143,7 @@ void effect7() {
 
 // Effect 8: Twinkle
 void effect8() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     // Randomly twinkle LEDs
     if (random(10) == 0) {
       int led = random(NUM_LEDS);
@@ -1884,8 +6167,7 @@ void effect8() {
 
 // Effect 9: Cycling Wipe
 void effect9() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if (i == effectPosition) {
         strip.setPixelColor(i, currentColor);
@@ -1901,8 +6183,7 @@ void effect9() {
 
 // Effect 10: Fire
 void effect10() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int flicker = random(150, 255);
       int r = flicker;
@@ -1916,8 +6197,7 @@ void effect10() {
 
 // Effect 11: Confetti
 void effect11() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Fade all LEDs
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -1940,8 +6220,7 @@ void effect11() {
 
 // Effect 12: Police
 void effect12() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     if (effectCounter % 4 < 2) {
       // Red
       for (int i = 0; i < NUM_LEDS; i++) {
@@ -1962,8 +6241,7 @@ void effect12() {
 
 // Effect 13: BPM
 void effect13() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     int beat = sin8(effectCounter);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel(beat + (i * 85)));
@@ -1976,8 +6254,7 @@ void effect13() {
 
 // Effect 14: Strobe
 void effect14() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     if (effectCounter % 2 == 0) {
       for (int i = 0; i < NUM_LEDS; i++) {
         strip.setPixelColor(i, strip.Color(255, 255, 255));
@@ -1994,8 +6271,7 @@ void effect14() {
 
 // Effect 15: Waves
 void effect15() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, strip.Color(wave, wave/2, 255-wave));
@@ -2008,8 +6284,7 @@ void effect15() {
 
 // Effect 16: Comet
 void effect16() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2031,8 +6306,7 @@ void effect16() {
 
 // Effect 17: Checkerboard
 void effect17() {
-  if (millis() - lastEffectUpdate > 500) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(500)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectCounter) % 2 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -2062,8 +6336,7 @@ void effect18() {
 
 // Effect 19: Rainbow Fast
 void effect19() {
-  if (millis() - lastEffectUpdate > 20) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(20)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + effectCounter) & 255));
     }
@@ -2075,8 +6348,7 @@ void effect19() {
 
 // Effect 20: Reverse Wipe
 void effect20() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     strip.setPixelColor(NUM_LEDS - 1 - effectPosition, currentColor);
     strip.show();
     effectPosition++;
@@ -2091,8 +6363,7 @@ void effect20() {
 
 // Effect 21: Theater Rainbow
 void effect21() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectPosition) % 2 == 0) {
         strip.setPixelColor(i, Wheel((i * 85) & 255));
@@ -2108,8 +6379,7 @@ void effect21() {
 
 // Effect 22: Twinkle Random
 void effect22() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2132,8 +6402,7 @@ void effect22() {
 
 // Effect 23: Pulse
 void effect23() {
-  if (millis() - lastEffectUpdate > 40) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(40)) {
     int pulse = sin8(effectCounter);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -2150,8 +6419,7 @@ void effect23() {
 
 // Effect 24: Sparkle
 void effect24() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Set all to dim
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(10, 10, 10));
@@ -2167,8 +6435,7 @@ void effect24() {
 
 // Effect 25: Bounce
 void effect25() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2184,8 +6451,7 @@ void effect25() {
 
 // Effect 26: Fade In Out
 void effect26() {
-  if (millis() - lastEffectUpdate > 40) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(40)) {
     int brightness = sin8(effectCounter);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -2202,8 +6468,7 @@ void effect26() {
 
 // Effect 27: Dual Chase
 void effect27() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectPosition) % 2 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -2220,8 +6485,7 @@ void effect27() {
 
 // Effect 28: Rainbow Wave
 void effect28() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, Wheel(wave));
@@ -2234,8 +6498,7 @@ void effect28() {
 
 // Effect 29: Meteor Rainbow
 void effect29() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2264,8 +6527,7 @@ void effect29() {
 
 // Effect 30: Breath
 void effect30() {
-  if (millis() - lastEffectUpdate > 40) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(40)) {
     int breath = (exp(sin(effectCounter * 0.01)) - 0.36787944) * 108.0;
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -2281,8 +6543,7 @@ void effect30() {
 
 // Effect 31: Spiral
 void effect31() {
-  if (millis() - lastEffectUpdate > 200) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(200)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2301,8 +6562,7 @@ void effect31() {
 
 // Effect 32: Random Flash
 void effect32() {
-  if (millis() - lastEffectUpdate > 300) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(300)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2318,8 +6578,7 @@ void effect32() {
 
 // Effect 33: Alternate
 void effect33() {
-  if (millis() - lastEffectUpdate > 500) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(500)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectCounter) % 2 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -2334,8 +6593,7 @@ void effect33() {
 
 // Effect 34: Color Chase
 void effect34() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2354,8 +6612,7 @@ void effect34() {
 
 // Effect 35: Double Comet
 void effect35() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2379,8 +6636,7 @@ void effect35() {
 
 // Effect 36: Rainbow Bounce
 void effect36() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2397,8 +6653,7 @@ void effect36() {
 
 // Effect 37: Pulse Rainbow
 void effect37() {
-  if (millis() - lastEffectUpdate > 40) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(40)) {
     int pulse = sin8(effectCounter);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + effectCounter) % 256));
@@ -2411,8 +6666,7 @@ void effect37() {
 
 // Effect 38: Dense Sparkle
 void effect38() {
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     // Set all to very dim
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(5, 5, 5));
@@ -2428,8 +6682,7 @@ void effect38() {
 
 // Effect 39: Dual Wave
 void effect39() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave1 = sin8((i * 85) + effectCounter);
       int wave2 = sin8((i * 85) + effectCounter + 128);
@@ -2443,8 +6696,7 @@ void effect39() {
 
 // Effect 40: Chase Rainbow
 void effect40() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectPosition) % 2 == 0) {
         strip.setPixelColor(i, Wheel((i * 85 + effectCounter) % 256));
@@ -2461,8 +6713,7 @@ void effect40() {
 
 // Effect 41: Dense Twinkle
 void effect41() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Fade all quickly
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2487,8 +6738,7 @@ void effect41() {
 
 // Effect 42: Moving Blocks
 void effect42() {
-  if (millis() - lastEffectUpdate > 300) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(300)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int block = (i + effectPosition) % 3;
       if (block == 0) strip.setPixelColor(i, currentColor);
@@ -2503,8 +6753,7 @@ void effect42() {
 
 // Effect 43: Rainbow Spiral
 void effect43() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       strip.setPixelColor(pos, Wheel((i * 85 + effectCounter) % 256));
@@ -2519,8 +6768,7 @@ void effect43() {
 
 // Effect 44: Comet Rainbow
 void effect44() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2549,8 +6797,7 @@ void effect44() {
 
 // Effect 45: Fast Pulse
 void effect45() {
-  if (millis() - lastEffectUpdate > 20) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(20)) {
     int pulse = sin8(effectCounter * 3);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -2567,8 +6814,7 @@ void effect45() {
 
 // Effect 46: Sparkle Rainbow
 void effect46() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     // Dim all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(15, 15, 15));
@@ -2584,8 +6830,7 @@ void effect46() {
 
 // Effect 47: Alternate Rainbow
 void effect47() {
-  if (millis() - lastEffectUpdate > 300) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(300)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectCounter) % 2 == 0) {
         strip.setPixelColor(i, Wheel((i * 85) % 256));
@@ -2600,8 +6845,7 @@ void effect47() {
 
 // Effect 48: Slow Wave
 void effect48() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, strip.Color(wave, wave/3, 255-wave));
@@ -2614,8 +6858,7 @@ void effect48() {
 
 // Effect 49: Triple Chase
 void effect49() {
-  if (millis() - lastEffectUpdate > 200) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(200)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectPosition) % 3 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -2633,8 +6876,7 @@ void effect49() {
 
 // Effect 50: Bright Twinkle
 void effect50() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2657,8 +6899,7 @@ void effect50() {
 
 // Effect 51: Rainbow Pulse
 void effect51() {
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     int pulse = (sin8(effectCounter) + cos8(effectCounter)) / 2;
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + pulse) % 256));
@@ -2671,8 +6912,7 @@ void effect51() {
 
 // Effect 52: Moving Dots
 void effect52() {
-  if (millis() - lastEffectUpdate > 250) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(250)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2690,8 +6930,7 @@ void effect52() {
 
 // Effect 53: Multi Sparkle
 void effect53() {
-  if (millis() - lastEffectUpdate > 50) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(50)) {
     // Very fast fade
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2716,8 +6955,7 @@ void effect53() {
 
 // Effect 54: Wave Rainbow
 void effect54() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, Wheel(wave));
@@ -2730,8 +6968,7 @@ void effect54() {
 
 // Effect 55: Chase Blocks
 void effect55() {
-  if (millis() - lastEffectUpdate > 400) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(400)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int block = (i + effectPosition) % 3;
       if (block == 0) strip.setPixelColor(i, currentColor);
@@ -2746,8 +6983,7 @@ void effect55() {
 
 // Effect 56: Rainbow Sparkle
 void effect56() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     // Set background to rainbow
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + effectCounter) % 256));
@@ -2767,8 +7003,7 @@ void effect56() {
 
 // Effect 57: Alternate Blocks
 void effect57() {
-  if (millis() - lastEffectUpdate > 500) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(500)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectCounter) % 2 == 0) {
         strip.setPixelColor(i, currentColor);
@@ -2783,8 +7018,7 @@ void effect57() {
 
 // Effect 58: Dual Comet
 void effect58() {
-  if (millis() - lastEffectUpdate > 70) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(70)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -2808,8 +7042,7 @@ void effect58() {
 
 // Effect 59: Slow Pulse
 void effect59() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     int pulse = sin8(effectCounter / 2);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -2828,8 +7061,7 @@ void effect59() {
 
 // Effect 60: Music Visualizer
 void effect60() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     // Simulate music visualization with random brightness
     for (int i = 0; i < NUM_LEDS; i++) {
       int brightness = random(50, 255);
@@ -2845,8 +7077,7 @@ void effect60() {
 
 // Effect 61: Rainbow Fire
 void effect61() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int flicker = random(150, 255);
       int wave = sin8((i * 85) + effectCounter);
@@ -2863,8 +7094,7 @@ void effect61() {
 
 // Effect 62: Color Dance
 void effect62() {
-  if (millis() - lastEffectUpdate > 150) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(150)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave1 = sin8((i * 85) + effectCounter);
       int wave2 = sin8((i * 85) + effectCounter + 85);
@@ -2878,8 +7108,7 @@ void effect62() {
 
 // Effect 63: Matrix Rain
 void effect63() {
-  if (millis() - lastEffectUpdate > 140) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(140)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -2902,8 +7131,7 @@ void effect63() {
 
 // Effect 64: Galaxy Spin
 void effect64() {
-  if (millis() - lastEffectUpdate > 120) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(120)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       int brightness = sin8((i * 85) + effectCounter);
@@ -2919,8 +7147,7 @@ void effect64() {
 
 // Effect 65: Energy Pulse
 void effect65() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     int pulse = sin8(effectCounter * 3);
     for (int i = 0; i < NUM_LEDS; i++) {
       int distance = abs(i - NUM_LEDS/2);
@@ -2938,8 +7165,7 @@ void effect65() {
 
 // Effect 66: Water Ripple
 void effect66() {
-  if (millis() - lastEffectUpdate > 120) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(120)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, strip.Color(
@@ -2956,8 +7182,7 @@ void effect66() {
 // Effect 67: Heart Beat
 void effect67() {
   static int heartBeat = 0;
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     
     // Heart beat pattern
     int beat = sin8(heartBeat);
@@ -2973,8 +7198,7 @@ void effect67() {
 
 // Effect 68: Christmas Lights
 void effect68() {
-  if (millis() - lastEffectUpdate > 400) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(400)) {
     // Alternate between red and green
     for (int i = 0; i < NUM_LEDS; i++) {
       if ((i + effectCounter) % 2 == 0) {
@@ -2990,8 +7214,7 @@ void effect68() {
 
 // Effect 69: Fireworks
 void effect69() {
-  if (millis() - lastEffectUpdate > 300) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(300)) {
     
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
@@ -3016,8 +7239,7 @@ void effect69() {
 
 // Effect 70: Plasma Ball
 void effect70() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int plasma = sin8(i * 85 + effectCounter) + 
                    sin8(effectCounter * 2) + 
@@ -3031,8 +7253,7 @@ void effect70() {
 
 // Effect 71: Lava Lamp
 void effect71() {
-  if (millis() - lastEffectUpdate > 160) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(160)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int lava = sin8(i * 85 + effectCounter * 2);
       strip.setPixelColor(i, strip.Color(
@@ -3048,8 +7269,7 @@ void effect71() {
 
 // Effect 72: Aurora Borealis
 void effect72() {
-  if (millis() - lastEffectUpdate > 140) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(140)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave1 = sin8((i * 85) + effectCounter);
       int wave2 = sin8((i * 85) + effectCounter + 64);
@@ -3066,8 +7286,7 @@ void effect72() {
 
 // Effect 73: Ocean Waves
 void effect73() {
-  if (millis() - lastEffectUpdate > 120) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(120)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
       strip.setPixelColor(i, strip.Color(
@@ -3083,8 +7302,7 @@ void effect73() {
 
 // Effect 74: Desert Sunset
 void effect74() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int sunset = sin8(i * 85 + effectCounter);
       strip.setPixelColor(i, strip.Color(
@@ -3100,8 +7318,7 @@ void effect74() {
 
 // Effect 75: Northern Lights
 void effect75() {
-  if (millis() - lastEffectUpdate > 180) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(180)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter + random(-10, 10));
       strip.setPixelColor(i, strip.Color(
@@ -3117,8 +7334,7 @@ void effect75() {
 
 // Effect 76: Rainbow Tornado
 void effect76() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       strip.setPixelColor(pos, Wheel((i * 85 + effectCounter) % 256));
@@ -3131,8 +7347,7 @@ void effect76() {
 
 // Effect 77: Color Tornado
 void effect77() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       strip.setPixelColor(pos, currentColor);
@@ -3144,8 +7359,7 @@ void effect77() {
 
 // Effect 78: Sparkle Storm
 void effect78() {
-  if (millis() - lastEffectUpdate > 40) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(40)) {
     // Very fast fade
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -3170,8 +7384,7 @@ void effect78() {
 
 // Effect 79: Rainbow Explosion
 void effect79() {
-  if (millis() - lastEffectUpdate > 200) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(200)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -3192,17 +7405,19 @@ void effect79() {
 }
 
 // ========== WHITE EFFECTS 80-84 ==========
+// With circadian on (/schedule?circadian=1) these draw their white from
+// circadianWhite() - the color temperature for the time of day.
 
 // Effect 80: Warm Glow
 void effect80() {
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     int intensity = sin8(effectCounter);
-    uint32_t warmWhite = strip.Color(
-      map(intensity, 0, 255, 100, 255),
-      map(intensity, 0, 255, 80, 200),
-      map(intensity, 0, 255, 60, 150)
-    );
+    uint32_t warmWhite = schedule.circadian ? circadianWhite(map(intensity, 0, 255, 100, 255)) :
+      strip.Color(
+        map(intensity, 0, 255, 100, 255),
+        map(intensity, 0, 255, 80, 200),
+        map(intensity, 0, 255, 60, 150)
+      );
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, warmWhite);
     }
@@ -3214,14 +7429,14 @@ void effect80() {
 
 // Effect 81: Cool Pulse
 void effect81() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     int intensity = sin8(effectCounter * 2);
-    uint32_t coolWhite = strip.Color(
-      map(intensity, 0, 255, 80, 200),
-      map(intensity, 0, 255, 100, 220),
-      map(intensity, 0, 255, 120, 255)
-    );
+    uint32_t coolWhite = schedule.circadian ? circadianWhite(map(intensity, 0, 255, 120, 255)) :
+      strip.Color(
+        map(intensity, 0, 255, 80, 200),
+        map(intensity, 0, 255, 100, 220),
+        map(intensity, 0, 255, 120, 255)
+      );
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, coolWhite);
     }
@@ -3233,11 +7448,10 @@ void effect81() {
 
 // Effect 82: White Strobe
 void effect82() {
-  if (millis() - lastEffectUpdate > 200) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(200)) {
     if (effectCounter % 2 == 0) {
       for (int i = 0; i < NUM_LEDS; i++) {
-        strip.setPixelColor(i, strip.Color(255, 255, 255));
+        strip.setPixelColor(i, schedule.circadian ? circadianWhite(255) : strip.Color(255, 255, 255));
       }
     } else {
       for (int i = 0; i < NUM_LEDS; i++) {
@@ -3251,15 +7465,15 @@ void effect82() {
 
 // Effect 83: Soft Fade
 void effect83() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave = sin8((i * 85) + effectCounter);
-      uint32_t softWhite = strip.Color(
-        wave,
-        wave * 0.9,
-        wave * 0.8
-      );
+      uint32_t softWhite = schedule.circadian ? circadianWhite(wave) :
+        strip.Color(
+          wave,
+          wave * 0.9,
+          wave * 0.8
+        );
       strip.setPixelColor(i, softWhite);
     }
     strip.show();
@@ -3270,13 +7484,17 @@ void effect83() {
 
 // Effect 84: Candle Light
 void effect84() {
-  if (millis() - lastEffectUpdate > random(100, 300)) {
-    lastEffectUpdate = millis();
+  if (effectMillis() - lastEffectUpdate > random(100, 300)) {
+    lastEffectUpdate = effectMillis();
     int flicker = random(150, 255);
     uint32_t candleColor = strip.Color(255, flicker * 0.6, flicker * 0.2);
     
     for (int i = 0; i < NUM_LEDS; i++) {
       int variation = random(-30, 30);
+      if (schedule.circadian) {
+        strip.setPixelColor(i, circadianWhite(constrain(flicker + variation, 120, 255)));
+        continue;
+      }
       strip.setPixelColor(i, strip.Color(
         constrain(255 + variation, 180, 255),
         constrain(flicker * 0.6 + variation, 60, 200),
@@ -3291,8 +7509,7 @@ void effect84() {
 
 // Effect 85: Laser Scan
 void effect85() {
-  if (millis() - lastEffectUpdate > 160) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(160)) {
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, 0);
@@ -3307,8 +7524,7 @@ void effect85() {
 
 // Effect 86: Digital Rain
 void effect86() {
-  if (millis() - lastEffectUpdate > 200) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(200)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -3331,8 +7547,7 @@ void effect86() {
 
 // Effect 87: Color Wheel
 void effect87() {
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, Wheel((i * 85 + effectCounter) % 256));
     }
@@ -3344,8 +7559,7 @@ void effect87() {
 
 // Effect 88: Particle Flow
 void effect88() {
-  if (millis() - lastEffectUpdate > 120) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(120)) {
     // Fade all
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -3369,8 +7583,7 @@ void effect88() {
 
 // Effect 89: Hypnotic Spiral
 void effect89() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       int brightness = sin8((i * 85) + effectCounter);
@@ -3387,8 +7600,8 @@ void effect90() {
   static unsigned long lastBinaryUpdate = 0;
   static int binaryValue = 0;
   
-  if (millis() - lastBinaryUpdate > 1000) {
-    lastBinaryUpdate = millis();
+  if (effectMillis() - lastBinaryUpdate > 1000) {
+    lastBinaryUpdate = effectMillis();
     
     // Clear all
     for (int i = 0; i < NUM_LEDS; i++) {
@@ -3410,8 +7623,7 @@ void effect90() {
 
 // Effect 91: Color Symphony
 void effect91() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int wave1 = sin8((i * 85) + effectCounter);
       int wave2 = sin8((i * 85) + effectCounter + 85);
@@ -3425,8 +7637,7 @@ void effect91() {
 
 // Effect 92: Neon Pulse
 void effect92() {
-  if (millis() - lastEffectUpdate > 60) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(60)) {
     int pulse = sin8(effectCounter * 3);
     for (int i = 0; i < NUM_LEDS; i++) {
       strip.setPixelColor(i, strip.Color(
@@ -3442,8 +7653,7 @@ void effect92() {
 
 // Effect 93: Gradient Flow
 void effect93() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int gradient = (i * 85 + effectCounter) % 256;
       strip.setPixelColor(i, Wheel(gradient));
@@ -3455,8 +7665,7 @@ void effect93() {
 
 // Effect 94: Pixel Dance
 void effect94() {
-  if (millis() - lastEffectUpdate > 300) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(300)) {
     // Random pixel dance
     for (int i = 0; i < NUM_LEDS; i++) {
       if (random(5) == 0) {
@@ -3471,8 +7680,7 @@ void effect94() {
 
 // Effect 95: Color Vortex
 void effect95() {
-  if (millis() - lastEffectUpdate > 80) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(80)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int pos = (i + effectPosition) % NUM_LEDS;
       int vortex = sin8((i * 85) + effectCounter);
@@ -3486,8 +7694,7 @@ void effect95() {
 
 // Effect 96: Rainbow Ripple
 void effect96() {
-  if (millis() - lastEffectUpdate > 120) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(120)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int ripple = sin8((i * 85) + effectCounter + sin8(effectCounter / 2));
       strip.setPixelColor(i, Wheel(ripple));
@@ -3499,8 +7706,7 @@ void effect96() {
 
 // Effect 97: Matrix Code
 void effect97() {
-  if (millis() - lastEffectUpdate > 240) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(240)) {
     // Matrix code effect
     for (int i = 0; i < NUM_LEDS; i++) {
       if (random(15) == 0) {
@@ -3522,8 +7728,7 @@ void effect97() {
 
 // Effect 98: Cyber Pulse
 void effect98() {
-  if (millis() - lastEffectUpdate > 100) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(100)) {
     for (int i = 0; i < NUM_LEDS; i++) {
       int cyber = sin8((i * 85) + effectCounter) + sin8((i * 85) + effectCounter * 2);
       cyber = cyber % 256;
@@ -3540,8 +7745,7 @@ void effect98() {
 
 // Effect 99: Star Field
 void effect99() {
-  if (millis() - lastEffectUpdate > 160) {
-    lastEffectUpdate = millis();
+  if (effectStepDue(160)) {
     // Fade stars
     for (int i = 0; i < NUM_LEDS; i++) {
       uint32_t color = strip.getPixelColor(i);
@@ -3571,21 +7775,28 @@ void effect99() {
 void handleMusicEffects() {
   if (!musicPlaying) return;
   
-  unsigned long currentMillis = millis();
+  unsigned long currentMillis = effectMillis();
   int updateInterval = map(effectSpeed, 0, 100, 200, 10);
   
-  if (currentMillis - lastMusicUpdate > updateInterval) {
-    lastMusicUpdate = currentMillis;
+  // With audio streaming from the page every frame is rendered as it
+  // arrives, otherwise the effects run on their timer
+  bool newAudioFrame = timelinePlaying ? takeTimelineFrame() : takeAudioFrame();
+  updateBeatClock();
+  
+  if (audioLive ? newAudioFrame : currentMillis - lastMusicUpdate > updateInterval) {
+    // On the timer, steps fall on the same clock slots on every lamp
+    lastMusicUpdate = audioLive ? currentMillis : currentMillis - currentMillis % (updateInterval + 1);
     
     // Map music effect parameters
     int densityFactor = map(musicDensity, 0, 100, 1, 10);
     int roughnessFactor = map(musicRoughness, 0, 100, 10, 100);
     int glowFactor = map(glowingSpeed, 0, 100, 1, 10);
+    uint8_t sectionHue = timelinePlaying ? timelineSection * 48 : 0;
     
     switch(currentMusicEffect) {
       case 0: // Beat Pulse
         {
-          int pulse = sin8(musicEffectCounter * densityFactor);
+          int pulse = audioLive ? audioBass() * beatEnvelope() / 255 : sin8(musicEffectCounter * densityFactor);
           for (int i = 0; i < NUM_LEDS; i++) {
             int brightness = pulse - (i * 20);
             if (brightness < 0) brightness = 0;
@@ -3598,7 +7809,7 @@ void handleMusicEffects() {
         {
           for (int i = 0; i < NUM_LEDS; i++) {
             int wave = sin8((i * 85) + musicEffectCounter * glowFactor);
-            strip.setPixelColor(i, Wheel(wave));
+            strip.setPixelColor(i, Wheel(wave + sectionHue)); // New colors per song section
           }
         }
         break;
@@ -3606,7 +7817,13 @@ void handleMusicEffects() {
       case 2: // Spectrum Analyzer
         {
           for (int i = 0; i < NUM_LEDS; i++) {
+            // Each LED shows its share of the bands, roughness sets the gain
             int height = random(0, roughnessFactor * 2);
+            if (audioLive) {
+              height = audioPeak(i * AUDIO_BANDS / NUM_LEDS, (i + 1) * AUDIO_BANDS / NUM_LEDS) *
+                       roughnessFactor / 50;
+              if (height > 255) height = 255;
+            }
             int r = height;
             int g = height * 0.5;
             int b = 255 - height;
@@ -3617,7 +7834,7 @@ void handleMusicEffects() {
         
       case 3: // Bass React
         {
-          int bass = sin8(musicEffectCounter * densityFactor);
+          int bass = audioLive ? audioBass() : sin8(musicEffectCounter * densityFactor);
           for (int i = 0; i < NUM_LEDS; i++) {
             int intensity = bass - (i * 30);
             if (intensity < 0) intensity = 0;
@@ -3630,6 +7847,7 @@ void handleMusicEffects() {
         {
           for (int i = 0; i < NUM_LEDS; i++) {
             int treble = sin8((i * 85) + musicEffectCounter * 3);
+            if (audioLive) treble = treble * audioTreble() / 255;
             strip.setPixelColor(i, strip.Color(treble, 0, treble));
           }
         }
@@ -3638,7 +7856,8 @@ void handleMusicEffects() {
       case 5: // Energy Flow
         {
           for (int i = 0; i < NUM_LEDS; i++) {
-            int energy = sin8((i * 85 * densityFactor) + musicEffectCounter);
+            int energy = sin8((i * 85 * densityFactor) + musicEffectCounter +
+                              (audioLive ? audioEnergy() : 0));
             int r = energy;
             int g = 255 - energy;
             int b = energy / 2;
@@ -3649,7 +7868,9 @@ void handleMusicEffects() {
         
       case 6: // Rhythm Flash
         {
-          if ((musicEffectCounter / glowFactor) % 2 == 0) {
+          bool flash = (musicEffectCounter / glowFactor) % 2 == 0;
+          if (audioLive) flash = beatLocked ? beatPhase < 64 : audioOnset; // First quarter of each beat
+          if (flash) {
             for (int i = 0; i < NUM_LEDS; i++) {
               strip.setPixelColor(i, Wheel(random(256)));
             }
@@ -3665,6 +7886,7 @@ void handleMusicEffects() {
         {
           for (int i = 0; i < NUM_LEDS; i++) {
             int glow = sin8((i * 85 * densityFactor) + musicEffectCounter);
+            if (audioLive) glow = glow * audioEnergy() / 255;
             strip.setPixelColor(i, strip.Color(glow, glow/2, glow/4));
           }
         }
@@ -3675,18 +7897,19 @@ void handleMusicEffects() {
           for (int i = 0; i < NUM_LEDS; i++) {
             if ((i + musicEffectPosition) % 2 == 0) {
               int brightness = sin8(musicEffectCounter * glowFactor);
-              strip.setPixelColor(i, Wheel((musicEffectCounter * 10 + i * 85) % 256));
+              strip.setPixelColor(i, Wheel((musicEffectCounter * 10 + i * 85 + sectionHue) % 256));
             } else {
               strip.setPixelColor(i, 0);
             }
           }
-          musicEffectPosition++;
+          // Step on the beat
+          if (!audioLive || (beatLocked ? beatTick : audioOnset)) musicEffectPosition++;
         }
         break;
         
       case 9: // Frequency Pulse
         {
-          int pulse = sin8(musicEffectCounter * densityFactor * 2);
+          int pulse = audioLive ? audioEnergy() : sin8(musicEffectCounter * densityFactor * 2);
           for (int i = 0; i < NUM_LEDS; i++) {
             int offset = i * roughnessFactor;
             int r = pulse;
@@ -3699,6 +7922,7 @@ void handleMusicEffects() {
     }
     
     strip.show();
+    beatTick = false;
     musicEffectCounter++;
     if (musicEffectCounter >= 256) musicEffectCounter = 0;
   }
@@ -3706,10 +7930,10 @@ void handleMusicEffects() {
 
 // ========== AUTOMATIC MODE WHEN NO WIFI ==========
 void runAutomaticMode() {
-  // Simple white glow when no WiFi clients
-  uint32_t whiteColor = strip.Color(255, 255, 255);
+  // Steady glow in the color that was last set (restored at boot, picked on
+  // the page or warmed up by a sunrise) when no WiFi clients
   for (int i = 0; i < NUM_LEDS; i++) {
-    strip.setPixelColor(i, whiteColor);
+    strip.setPixelColor(i, currentColor);
   }
   strip.show();
 }
@@ -3726,12 +7950,12 @@ void checkAndMaintainWiFi() {
     lastWifiCheck = currentMillis;
     
     // Check if AP is still running
-    int stationCount = WiFi.softAPgetStationNum();
+    int stationCount = apStationCount;
     Serial.print("Stations connected: ");
     Serial.println(stationCount);
     
     // If no stations for too long, consider reducing power
-    if (stationCount == 0 && currentMillis > 300000) { // After 5 minutes
+    if (wifiState == WIFI_STATE_AP && stationCount == 0 && currentMillis > 300000) { // After 5 minutes
       // Reduce WiFi power to save energy
       WiFi.setOutputPower(10.5); // Reduce from 20.5 dBm
     }
@@ -3747,6 +7971,7 @@ void checkAndMaintainWiFi() {
     // If memory is critically low, restart
     if (freeHeap < 2000) {
       Serial.println("Low memory! Restarting...");
+      flushSavedState();
       ESP.reset();
     }
   }
@@ -3798,6 +8023,46 @@ void testSequence() {
   Serial.println("Features: 3 LEDs, Touch control, Music panel, 100 effects, 10 music effects");
 }
 
+// The boot is fast by default; the ~27 s self-test (test sequence plus the
+// green ready blinks) runs only when the touch sensor is held through
+// BOOT_SELF_TEST_HOLD at power-up, or on GET /selftest. The settings come
+// back afterwards.
+#define BOOT_SELF_TEST_HOLD 1000 // ms the sensor must stay held at boot
+
+bool touchHeldAtBoot() {
+  unsigned long start = millis();
+  while (digitalRead(TOUCH_SENSOR_PIN) == LOW) {
+    if (millis() - start >= BOOT_SELF_TEST_HOLD) return true;
+    delay(10);
+  }
+  return false;
+}
+
+void runSelfTest() {
+  int32_t state[COMMAND_TYPES];
+  readCurrentState(state);
+  bool wasPlaying = musicPlaying;
+  
+  testSequence();
+  
+  // Show touch sensor ready indication
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < NUM_LEDS; j++) {
+      strip.setPixelColor(j, strip.Color(0, 255, 0)); // Green for ready
+    }
+    strip.show();
+    delay(200);
+    for (int j = 0; j < NUM_LEDS; j++) {
+      strip.setPixelColor(j, 0);
+    }
+    strip.show();
+    delay(200);
+  }
+  
+  applyState(state);
+  musicPlaying = wasPlaying;
+}
+
 // ========== SETUP WITH STABILITY IMPROVEMENTS ==========
 void setup() {
   // Initialize serial communication
@@ -3816,8 +8081,23 @@ void setup() {
   pinMode(TOUCH_SENSOR_PIN, INPUT_PULLUP); // Touch sensor with internal pull-up
   Serial.println("Touch sensor initialized on pin D4 (GPIO2)");
   
-  // Initial test sequence
-  testSequence();
+  // Microphone analysis tables (the sampler starts with music mode)
+  initFft();
+  
+  // Last settings straight back on the LEDs
+  LittleFS.begin();
+  restoreSavedState();
+  bootFirstFrameMillis = millis();
+  initPresets();
+  loadPlaylist();
+  loadSchedule();
+  loadTouchMap();
+  openTimeline(); // Header cached for GET /timeline
+  
+  // Full self-test only when asked for
+  bootSelfTest = touchHeldAtBoot();
+  if (bootSelfTest) runSelfTest();
+  startTouchInput();
   
   // ========== CRITICAL STABILITY IMPROVEMENTS ==========
   
@@ -3827,56 +8107,78 @@ void setup() {
   // 2. Reduce WiFi TX power to prevent crashes
   WiFi.setOutputPower(15.5); // Reduced from 20.5 dBm
   
-  // 3. Set WiFi to AP mode only
-  WiFi.mode(WIFI_AP);
-  
-  // 4. Set a static IP to avoid DHCP issues
-  WiFi.softAPConfig(apIP, gateway, subnet);
-  
-  // 5. Set better WiFi parameters
-  wifi_set_phy_mode(PHY_MODE_11N);  // Use 802.11n mode
-  wifi_set_channel(6);  // Set to channel 6 (less crowded)
-  
-  // 6. Start Access Point with stability settings
-  bool apStarted = WiFi.softAP(ssid, password, 6, 0, 4);
+  // 3. Count phones on our AP as they come and go
+  apStationConnectedHandler = WiFi.onSoftAPModeStationConnected(
+    [](const WiFiEventSoftAPModeStationConnected &) {
+      apStationCount++;
+    });
+  apStationDisconnectedHandler = WiFi.onSoftAPModeStationDisconnected(
+    [](const WiFiEventSoftAPModeStationDisconnected &) {
+      if (apStationCount > 0) apStationCount--;
+    });
   
-  if (!apStarted) {
-    Serial.println("Failed to start AP! Retrying...");
-    delay(1000);
-    ESP.restart();
+  // 4. Join the home network if one is saved, otherwise start our own AP
+  wifiConfigValid = loadWifiConfig();
+  if (wifiConfigValid) {
+    startStation();
+  } else {
+    startAccessPoint(false);
   }
   
-  Serial.println("Access Point Started");
-  Serial.print("SSID: ");
-  Serial.println(ssid);
-  Serial.print("IP Address: ");
-  Serial.println(WiFi.softAPIP());
-  Serial.print("MAC Address: ");
-  Serial.println(WiFi.softAPmacAddress());
-  
   // ========== SETUP WEB SERVER WITH TIMEOUTS ==========
   
-  // Setup web server routes
-  webServer.on("/", handleRoot);
-  webServer.on("/color", handleColor);
-  webServer.on("/brightness", handleBrightness);
-  webServer.on("/toggle", handleToggle);
-  webServer.on("/effect", handleEffect);
-  webServer.on("/music", handleMusic);
-  webServer.on("/density", handleMusic);
-  webServer.on("/roughness", handleMusic);
-  webServer.on("/effectSpeed", handleMusic);
-  webServer.on("/glowingSpeed", handleMusic);
+  // Setup web server routes - requests are handled in TCP callbacks,
+  // so loop() never polls the server
+  webServer.on("/", HTTP_GET, handleRoot);
+  webServer.on("/color", HTTP_GET, handleColor);
+  webServer.on("/brightness", HTTP_GET, handleBrightness);
+  webServer.on("/toggle", HTTP_GET, handleToggle);
+  webServer.on("/effect", HTTP_GET, handleEffect);
+  webServer.on("/music", HTTP_GET, handleMusic);
+  webServer.on("/density", HTTP_GET, handleMusicSlider);
+  webServer.on("/roughness", HTTP_GET, handleMusicSlider);
+  webServer.on("/effectSpeed", HTTP_GET, handleMusicSlider);
+  webServer.on("/glowingSpeed", HTTP_GET, handleMusicSlider);
+  webServer.on("/state", HTTP_GET, handleGetState);
+  webServer.on("/state", HTTP_POST, handlePostState, NULL, handleStateBody);
+  webServer.on("/stats", HTTP_GET, handleStats);
+  webServer.on("/sync", HTTP_GET, handleSync);
+  webServer.on("/selftest", HTTP_GET, handleSelfTest);
+  webServer.on("/preset", HTTP_GET, handlePreset);
+  webServer.on("/playlist", HTTP_GET, handlePlaylist);
+  webServer.on("/schedule", HTTP_GET, handleSchedule);
+  webServer.on("/time", HTTP_GET, handleTime);
+  webServer.on("/touch", HTTP_GET, handleTouch);
+  webServer.on("/wifi", HTTP_GET, handleWifiStatus);
+  webServer.on("/wifi", HTTP_POST, handleWifiConfig);
+  webServer.on("/audio", HTTP_GET, handleAudio);
+  webServer.on("/timeline", HTTP_GET, handleTimelineInfo);
+  webServer.on("/timeline", HTTP_POST, handleTimelineUpload, NULL, handleTimelineBody);
+  webServer.on("/favicon.ico", HTTP_GET, handleFavicon);
+  for (uint8_t i = 0; i < sizeof(captiveProbePaths) / sizeof(captiveProbePaths[0]); i++) {
+    webServer.on(captiveProbePaths[i], HTTP_GET, handleCaptiveProbe);
+  }
   webServer.onNotFound(handleNotFound);
   
-  // Set web server timeouts to prevent hanging
-  webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  // WebSocket control channel used by the web page
+  ws.onEvent(onWebSocketEvent);
+  webServer.addHandler(&ws);
+  
   webServer.begin();
+  bootReadyMillis = millis();
+  
+  // Realtime pixel streaming and multi-lamp sync - reopened by
+  // maintainStation() once the home network gives us an address
+  if (!wifiConfigValid) beginUdpListeners();
   
   Serial.println("HTTP server started");
-  Serial.println("Connect to WiFi: " + String(ssid));
-  Serial.println("Password: " + String(password));
-  Serial.println("Then open: http://192.168.4.1");
+  if (!wifiConfigValid) {
+    Serial.print("Connect to WiFi: ");
+    Serial.println(ssid);
+    Serial.print("Password: ");
+    Serial.println(password);
+    Serial.println("Then open: http://192.168.4.1");
+  }
   
   // ========== WATCHDOG AND TIMER SETUP ==========
   
@@ -3894,19 +8196,13 @@ void setup() {
   Serial.println("Features: 3 LEDs, 100 effects, Touch control, Music control panel");
   Serial.println("Music Effects: 10 different effects with 4 control sliders");
   
-  // Show touch sensor ready indication
-  for (int i = 0; i < 3; i++) {
-    for (int j = 0; j < NUM_LEDS; j++) {
-      strip.setPixelColor(j, strip.Color(0, 255, 0)); // Green for ready
-    }
-    strip.show();
-    delay(200);
-    for (int j = 0; j < NUM_LEDS; j++) {
-      strip.setPixelColor(j, 0);
-    }
-    strip.show();
-    delay(200);
-  }
+  Serial.print("Boot: first frame at ");
+  Serial.print(bootFirstFrameMillis);
+  Serial.print(" ms, ready at ");
+  Serial.print(bootReadyMillis);
+  Serial.print(" ms, setup done at ");
+  Serial.print(millis());
+  Serial.println(bootSelfTest ? " ms (with self-test)" : " ms");
 }
 
 // ========== MAIN LOOP WITH STABILITY CHECKS ==========
@@ -3914,6 +8210,39 @@ void loop() {
   // Feed the watchdog
   feedWatchdog();
   
+  // Frame timing stats for /stats
+  updateFrameStats();
+  
+  // Apply the latest values requested since the last frame
+  applyPendingCommands();
+  
+  // Preset saves and recalls asked for with /preset
+  handlePresets();
+  
+  // Next playlist entry when the current one is over
+  updatePlaylist();
+  
+  // Time-of-day rules and their ramps
+  updateSchedule();
+  
+  // Self-test asked for with GET /selftest
+  if (selfTestRequested) {
+    selfTestRequested = false;
+    runSelfTest();
+  }
+  
+  // Answer waiting captive-portal DNS queries (never blocks)
+  dnsServer.processNextRequest();
+  
+  // Free resources of closed control sockets
+  ws.cleanupClients();
+  
+  // Tell every open page what changed since the last push
+  broadcastStateChanges();
+  
+  // Save the settings to flash once they settle
+  maintainSavedState();
+  
   // Check stack canary periodically
   static unsigned long lastStackCheck = 0;
   if (millis() - lastStackCheck > 10000) { // Every 10 seconds
@@ -3922,21 +8251,35 @@ void loop() {
   }
   
   // WiFi maintenance
+  maintainStation();
   checkAndMaintainWiFi();
   
   // Always handle touch sensor (works regardless of WiFi status)
+  updateTouchMap();
   handleTouchSensor();
   
+  // Follow or lead other lamps
+  handleLampSync();
+  
+  // A PC is streaming pixels - the on-device effects stay paused
+  if (handleRealtimeUdp()) {
+    delay(1);
+    return;
+  }
+  
+  // Start or stop a pre-analysed song show
+  handleTimeline();
+  
+  // Room sound from the microphone, when music mode runs
+  handleMicrophone();
+  
   // Handle music effects if playing
   if (musicPlaying) {
     handleMusicEffects();
   }
   
-  // Check if WiFi has clients connected
-  if (WiFi.softAPgetStationNum() > 0) {
-    // Handle web requests if clients are connected
-    webServer.handleClient();
-    
+  // Check if WiFi has clients connected (on the home network anyone may be)
+  if (wifiState == WIFI_STATE_STATION || apStationCount > 0) {
     // Handle effects if one is running and music is not playing
     if (isPoweredOn && isEffectRunning && !musicPlaying) {
       switch(currentEffect) {
@@ -0,0 +1,692 @@
+// Generated by tools/embed_html.py from index_html in "Optic RGB code.cpp".
+// Do not edit by hand - re-run the script after changing the web page.
+#pragma once
+
+// Page: 55879 bytes, gzip: 10916 bytes
+#define INDEX_HTML_ETAG "\"64805b16\""
+const size_t index_html_gz_len = 10916;
+const uint8_t index_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x7d, 0xed, 0x76, 0xdb, 0xb6,
+  0xb2, 0xe8, 0xff, 0x3c, 0x05, 0xea, 0xdd, 0x56, 0x52, 0x23, 0xc9, 0xfa, 0xb0, 0x5c, 0xd7, 0x89,
+  0xdd, 0xe3, 0x0f, 0x39, 0xf1, 0xdd, 0xfe, 0xba, 0x96, 0xd3, 0x34, 0x2b, 0x27, 0xb7, 0xa1, 0x44,
+  0xc8, 0xe2, 0x0e, 0x45, 0xaa, 0x24, 0x15, 0xdb, 0xe9, 0xf1, 0x13, 0xdc, 0x07, 0x38, 0x6b, 0x9d,
+  0x7f, 0xe7, 0xd5, 0xf6, 0x93, 0x9c, 0x19, 0x00, 0x24, 0x41, 0x02, 0x20, 0x29, 0xdb, 0x69, 0xef,
+  0xda, 0xb7, 0x59, 0x4d, 0x24, 0x12, 0x18, 0x0c, 0x66, 0x06, 0x83, 0xf9, 0x02, 0xf4, 0xec, 0xe5,
+  0x37, 0x87, 0xe7, 0x07, 0x57, 0xef, 0x2e, 0x86, 0x64, 0x16, 0xcd, 0xdd, 0xdd, 0x67, 0x2f, 0xf1,
+  0x1f, 0xe2, 0x5a, 0xde, 0xf5, 0xce, 0x1a, 0xf5, 0xd6, 0xf0, 0x01, 0xb5, 0xec, 0xdd, 0x67, 0x04,
+  0xfe, 0x7b, 0x39, 0xa7, 0x91, 0x45, 0x26, 0x33, 0x2b, 0x08, 0x69, 0xb4, 0xb3, 0xf6, 0xe6, 0xea,
+  0xa8, 0xb5, 0xb5, 0x26, 0xbf, 0xf2, 0xac, 0x39, 0xdd, 0x59, 0xfb, 0xec, 0xd0, 0x9b, 0x85, 0x1f,
+  0x44, 0x6b, 0x64, 0xe2, 0x7b, 0x11, 0xf5, 0xa0, 0xe9, 0x8d, 0x63, 0x47, 0xb3, 0x1d, 0x9b, 0x7e,
+  0x76, 0x26, 0xb4, 0xc5, 0xbe, 0x34, 0x89, 0xe3, 0x39, 0x91, 0x63, 0xb9, 0xad, 0x70, 0x62, 0xb9,
+  0x74, 0xa7, 0xdb, 0xee, 0xc4, 0xa0, 0x22, 0x27, 0x72, 0xe9, 0xee, 0xc9, 0xf0, 0x90, 0x1c, 0x40,
+  0xff, 0xc0, 0x77, 0x5d, 0x1a, 0xbc, 0x5c, 0xe7, 0x4f, 0x79, 0x8b, 0x30, 0xba, 0x8b, 0x3f, 0xe3,
+  0x7f, 0x3f, 0x90, 0x3f, 0x92, 0xcf, 0xf8, 0xdf, 0xdc, 0x0a, 0xae, 0x1d, 0x6f, 0x9b, 0x74, 0x5e,
+  0x64, 0x1e, 0x2f, 0x2c, 0xdb, 0x76, 0xbc, 0x6b, 0xe5, 0xf9, 0xd8, 0xbf, 0x6d, 0x85, 0xce, 0x17,
+  0xf6, 0x6a, 0xec, 0x07, 0x36, 0x0d, 0x5a, 0xf0, 0x28, 0xdb, 0x66, 0x0a, 0x98, 0xb4, 0xa6, 0xd6,
+  0xdc, 0x71, 0xef, 0xb6, 0x49, 0x6d, 0x44, 0xaf, 0x7d, 0x4a, 0xde, 0x1c, 0xd7, 0x9a, 0xe4, 0xca,
+  0x9a, 0xf9, 0x73, 0xab, 0x49, 0x5e, 0x51, 0x8f, 0x7e, 0x86, 0x7f, 0x7f, 0xa1, 0x81, 0x6d, 0x79,
+  0xf0, 0x21, 0xb4, 0xbc, 0xb0, 0x15, 0xd2, 0xc0, 0x99, 0xa6, 0x90, 0xee, 0x93, 0x4f, 0xcf, 0xd2,
+  0xc1, 0xed, 0xbb, 0x1c, 0xfa, 0x63, 0x6b, 0xf2, 0xe9, 0x3a, 0xf0, 0x97, 0x9e, 0xdd, 0x9a, 0xf8,
+  0xae, 0x1f, 0x6c, 0x93, 0xbf, 0x1d, 0x1d, 0x1d, 0xfd, 0x34, 0xdc, 0xcc, 0xa2, 0x14, 0xbf, 0xeb,
+  0xf7, 0xfb, 0xd9, 0x17, 0x33, 0xea, 0x5c, 0xcf, 0xa2, 0x6d, 0xd2, 0xed, 0x74, 0x3e, 0xcf, 0xb2,
+  0xaf, 0xfc, 0xcf, 0x34, 0x98, 0xba, 0xfe, 0xcd, 0x36, 0x99, 0x39, 0xb6, 0x4d, 0xbd, 0x1c, 0x81,
+  0xfc, 0x10, 0x58, 0xe2, 0x03, 0xe5, 0x02, 0xea, 0x5a, 0x91, 0xf3, 0x99, 0x1a, 0x08, 0xd8, 0xeb,
+  0x2c, 0x6e, 0x0b, 0x67, 0xd5, 0x46, 0xa1, 0xa1, 0x41, 0x6e, 0x62, 0xb6, 0x13, 0x2e, 0x5c, 0x0b,
+  0x08, 0x38, 0x75, 0x69, 0x8e, 0xbe, 0xff, 0x58, 0x86, 0x91, 0x33, 0xbd, 0x6b, 0x09, 0x89, 0xd9,
+  0x26, 0xe1, 0xc2, 0x02, 0x51, 0x19, 0xd3, 0xe8, 0x86, 0xe6, 0xd1, 0xb4, 0x5c, 0xe7, 0xda, 0x6b,
+  0x39, 0x11, 0x9d, 0x87, 0xdb, 0x64, 0x02, 0xad, 0x69, 0xf0, 0x42, 0xc3, 0x7f, 0x60, 0x62, 0x14,
+  0xf9, 0xf3, 0x6d, 0xd2, 0x2f, 0xc5, 0x36, 0xf2, 0x17, 0xad, 0x71, 0xe4, 0xe5, 0xd0, 0x65, 0x72,
+  0xba, 0x4d, 0x36, 0x32, 0xdd, 0x65, 0x02, 0xab, 0x6f, 0x84, 0xf8, 0x04, 0x96, 0xed, 0x2c, 0x01,
+  0xb9, 0x41, 0xe7, 0xbb, 0x17, 0x65, 0xac, 0xdd, 0xfa, 0xf1, 0x60, 0x38, 0xdc, 0xd7, 0x81, 0xd9,
+  0x26, 0x9e, 0xef, 0x51, 0x2d, 0xd3, 0x6f, 0x66, 0x30, 0x7d, 0x8d, 0x84, 0x82, 0x18, 0x53, 0x60,
+  0xfc, 0xd6, 0x42, 0x27, 0xbe, 0x37, 0x02, 0xed, 0xb1, 0xef, 0xda, 0x39, 0xa8, 0xcb, 0x20, 0x44,
+  0xb0, 0x0b, 0xdf, 0x51, 0xa9, 0x59, 0xc0, 0xb5, 0x52, 0x4e, 0x28, 0x6c, 0xd5, 0x35, 0x62, 0xeb,
+  0x6f, 0x66, 0xd9, 0x28, 0x96, 0x1d, 0xb2, 0xb1, 0xb8, 0x25, 0x80, 0x3f, 0x09, 0xae, 0xc7, 0x56,
+  0xbd, 0xd3, 0x64, 0x7f, 0xda, 0xdd, 0x46, 0xb6, 0x4b, 0x14, 0xc0, 0xea, 0x12, 0xb2, 0x6a, 0xb9,
+  0x2e, 0xe9, 0xb4, 0xfb, 0x21, 0xa1, 0x56, 0x48, 0x2b, 0xf1, 0x79, 0x7b, 0x86, 0xeb, 0x20, 0xc7,
+  0x6d, 0x06, 0x72, 0xea, 0x07, 0x20, 0x30, 0x4c, 0x23, 0xd5, 0xbb, 0xca, 0xa8, 0x59, 0x44, 0x37,
+  0x01, 0xc9, 0x6e, 0x4f, 0xc1, 0x74, 0xd0, 0xa8, 0x86, 0x83, 0x35, 0xc1, 0x05, 0x56, 0x86, 0x44,
+  0xa7, 0xfd, 0x53, 0x19, 0x40, 0x26, 0x12, 0xad, 0x85, 0x33, 0xf9, 0x04, 0x92, 0x87, 0x84, 0xb6,
+  0x1c, 0xef, 0x51, 0x4b, 0xef, 0x49, 0x96, 0x94, 0x8c, 0x95, 0x7e, 0x5d, 0x0d, 0x3a, 0xc6, 0x85,
+  0xa5, 0x79, 0x55, 0x7d, 0x65, 0x6d, 0xe3, 0xb6, 0xe3, 0x4c, 0x5a, 0xd7, 0xd8, 0x16, 0xa6, 0x52,
+  0x0f, 0xa8, 0xdd, 0x24, 0x77, 0xd4, 0x05, 0xbd, 0xd7, 0x24, 0xae, 0x33, 0xa7, 0x4d, 0x62, 0xfd,
+  0xbe, 0x04, 0x15, 0x3d, 0x76, 0x97, 0xf0, 0x79, 0x6e, 0x5d, 0x43, 0x2b, 0xf8, 0x0a, 0xed, 0x1a,
+  0xab, 0x29, 0xc4, 0xac, 0x40, 0xa0, 0xd4, 0xf6, 0x06, 0x85, 0x02, 0x21, 0x2f, 0x6e, 0x6c, 0x1e,
+  0xfa, 0xae, 0x63, 0xeb, 0x56, 0xb3, 0x71, 0x45, 0x9a, 0x69, 0x1d, 0x52, 0x97, 0x4e, 0x22, 0xdf,
+  0x40, 0xed, 0xfe, 0xc0, 0x44, 0x6c, 0xf5, 0xcd, 0xea, 0x5a, 0x4c, 0x33, 0x83, 0x78, 0x9a, 0x1b,
+  0xc9, 0x34, 0xd5, 0x9d, 0x2a, 0xa5, 0xaf, 0x35, 0x86, 0x36, 0xcb, 0x3c, 0x0c, 0x58, 0x2b, 0x9a,
+  0xe1, 0x5d, 0x3a, 0x8d, 0x34, 0x8f, 0xa5, 0xb5, 0xc3, 0x3e, 0x02, 0xc3, 0x68, 0xbd, 0x05, 0xcd,
+  0x9a, 0x04, 0xff, 0x56, 0x58, 0xcb, 0x08, 0xdb, 0xa2, 0x9f, 0x81, 0xf9, 0xa1, 0x4e, 0xd5, 0x66,
+  0x99, 0x8b, 0x0b, 0x7d, 0x33, 0xcf, 0xdb, 0x7e, 0xc9, 0xd2, 0x1c, 0x07, 0x48, 0x62, 0x8f, 0x86,
+  0x21, 0x5b, 0x5d, 0x60, 0xca, 0x18, 0x2c, 0x15, 0x5c, 0x4f, 0x66, 0x73, 0xa5, 0xc2, 0x7e, 0x1b,
+  0x02, 0x81, 0x61, 0x36, 0xae, 0x35, 0xa6, 0xee, 0xd7, 0xd9, 0x75, 0x73, 0x1a, 0xa0, 0x3b, 0xd0,
+  0xee, 0x31, 0x95, 0x36, 0xa0, 0xcd, 0x4e, 0x47, 0x6f, 0xca, 0x0c, 0x06, 0x83, 0x2a, 0xd3, 0xd4,
+  0x4b, 0x38, 0x98, 0x3b, 0xdf, 0x19, 0x0c, 0xa1, 0x5e, 0x1e, 0x1d, 0x40, 0x65, 0xfc, 0xc9, 0x89,
+  0x5a, 0xd6, 0x62, 0x41, 0x2d, 0x10, 0x96, 0x09, 0xd5, 0x4a, 0x80, 0xa4, 0x53, 0x5c, 0x50, 0xaa,
+  0x56, 0x90, 0x2a, 0x95, 0xc8, 0x27, 0x8c, 0xb9, 0x4d, 0xf2, 0xb7, 0x4e, 0xa7, 0x03, 0x7f, 0x4f,
+  0xa7, 0xd3, 0x46, 0xe1, 0x32, 0xea, 0x2a, 0x3a, 0xcd, 0x5f, 0x46, 0x08, 0xf6, 0x81, 0xc2, 0xd7,
+  0x6d, 0x54, 0xa1, 0xd5, 0xf6, 0x76, 0x3c, 0x57, 0x21, 0x22, 0xd1, 0x6c, 0x39, 0x1f, 0xe7, 0x28,
+  0x58, 0x8d, 0x1c, 0x82, 0xce, 0xbd, 0x2d, 0x93, 0x26, 0x51, 0xdf, 0xac, 0xa2, 0xb5, 0x0b, 0x2d,
+  0xa1, 0xfe, 0x83, 0x94, 0x65, 0x45, 0x4a, 0xf6, 0x4a, 0xad, 0x8b, 0x5e, 0x15, 0xeb, 0xa2, 0x88,
+  0xe0, 0x0f, 0x36, 0x39, 0x64, 0x02, 0x0d, 0xc0, 0x09, 0xd8, 0xeb, 0x14, 0x23, 0xb1, 0x08, 0x28,
+  0x38, 0x67, 0xb0, 0x19, 0x4c, 0x10, 0x7f, 0x83, 0xba, 0x61, 0xbb, 0xd4, 0xa3, 0xd4, 0x0d, 0x07,
+  0xaf, 0xd5, 0x37, 0xb2, 0x1e, 0xd8, 0x5c, 0x4d, 0x0f, 0x94, 0xea, 0x98, 0x58, 0x51, 0x6c, 0x6e,
+  0xe6, 0x9c, 0xa1, 0x88, 0xde, 0x82, 0xf8, 0xa2, 0x39, 0xaa, 0xda, 0x2f, 0x05, 0x64, 0x62, 0xf0,
+  0x42, 0x93, 0xc2, 0xbc, 0x0e, 0x9c, 0x9c, 0xa1, 0x8c, 0x4f, 0x5a, 0x60, 0xee, 0x2e, 0x70, 0x73,
+  0xc1, 0xde, 0xcb, 0xb9, 0x17, 0xa2, 0x75, 0x00, 0xeb, 0x26, 0xaa, 0x6f, 0x36, 0x49, 0x77, 0x1a,
+  0xe4, 0x38, 0x78, 0x6d, 0x2d, 0x74, 0x33, 0xc9, 0x4d, 0xb5, 0x57, 0xd1, 0xa0, 0x32, 0x7a, 0x29,
+  0x83, 0x02, 0x63, 0x6a, 0xe5, 0x55, 0x69, 0x76, 0x3f, 0xaa, 0xaf, 0x34, 0xbd, 0x1d, 0x3f, 0x58,
+  0xdd, 0x90, 0xcf, 0x78, 0xf4, 0xc4, 0x5a, 0x46, 0x7e, 0x45, 0x42, 0x55, 0x5e, 0x73, 0x83, 0x07,
+  0xd8, 0xf9, 0xbd, 0x46, 0x55, 0x2c, 0x9e, 0xcc, 0xd0, 0x67, 0x9a, 0x2f, 0x36, 0xf4, 0x71, 0x6a,
+  0x20, 0xa4, 0x39, 0xb0, 0x95, 0x0c, 0xaa, 0x8e, 0xce, 0x9c, 0xea, 0xbc, 0x58, 0x71, 0x4f, 0xed,
+  0x54, 0xf0, 0x6d, 0x75, 0x61, 0x8b, 0x2f, 0x2d, 0xc7, 0xb3, 0xe9, 0x2d, 0x42, 0x30, 0xf8, 0x99,
+  0xaa, 0xd8, 0xa1, 0xe5, 0xd2, 0xb2, 0x9d, 0x80, 0x6b, 0x1d, 0x34, 0xf0, 0x71, 0xe1, 0x7d, 0x0d,
+  0x5f, 0x34, 0xd1, 0x82, 0x1b, 0xa5, 0x0b, 0x32, 0xc3, 0x0e, 0x16, 0x9d, 0x32, 0x2b, 0x42, 0x75,
+  0x67, 0xcc, 0xad, 0x7f, 0x35, 0x94, 0x60, 0x0c, 0xef, 0x98, 0x55, 0xa8, 0x19, 0x4b, 0x7f, 0x81,
+  0x84, 0x0b, 0xab, 0x5b, 0x86, 0x55, 0x28, 0xce, 0x34, 0x5b, 0x4f, 0xd1, 0x6c, 0x46, 0xd1, 0x99,
+  0x5b, 0xb7, 0xad, 0xc4, 0x1b, 0xa9, 0x48, 0x5e, 0x8e, 0x78, 0x75, 0xbc, 0x4b, 0xa5, 0x80, 0x23,
+  0xad, 0x50, 0xdb, 0x10, 0xda, 0xd2, 0x68, 0x4b, 0x4d, 0x83, 0x6a, 0xee, 0x90, 0xa2, 0x53, 0x06,
+  0x65, 0x51, 0x8e, 0x42, 0x6d, 0xfb, 0xc0, 0x10, 0x88, 0x4c, 0xd6, 0x32, 0x05, 0x99, 0xb8, 0x51,
+  0xef, 0xc0, 0x8f, 0x5a, 0xdc, 0x16, 0x6a, 0x49, 0xb4, 0x6e, 0x19, 0x6d, 0x56, 0x0c, 0x87, 0x70,
+  0x7c, 0x18, 0xdd, 0xf4, 0x1b, 0xdb, 0xa6, 0x71, 0x63, 0xdb, 0x2c, 0x63, 0x55, 0x76, 0xd7, 0xd5,
+  0x8e, 0x6e, 0x05, 0xf3, 0x16, 0x43, 0xc1, 0x18, 0x83, 0x55, 0x4d, 0xff, 0x6e, 0x7f, 0x60, 0xd3,
+  0xeb, 0x26, 0xaa, 0xb7, 0xe1, 0xc6, 0xfe, 0x00, 0x3f, 0x0c, 0x0e, 0x87, 0xfb, 0xfd, 0xd2, 0x1d,
+  0xc1, 0x77, 0x1f, 0x31, 0xd6, 0x00, 0xff, 0xc0, 0x87, 0xe1, 0xe6, 0x70, 0xf3, 0x68, 0xaf, 0x12,
+  0x55, 0x4b, 0xac, 0x33, 0x55, 0x92, 0xcb, 0xc2, 0x84, 0x3a, 0x95, 0xa4, 0xf5, 0x7b, 0x61, 0x46,
+  0x1a, 0x53, 0xa5, 0xd2, 0xee, 0xd4, 0x57, 0xb0, 0x0a, 0x44, 0x9c, 0xc2, 0xbc, 0x68, 0xd9, 0xf6,
+  0xac, 0x6a, 0xa2, 0x8a, 0xd1, 0xd6, 0xf2, 0x18, 0x86, 0xce, 0x3f, 0xcb, 0x2a, 0x05, 0xd5, 0x52,
+  0x2d, 0x5a, 0xbb, 0x8f, 0x30, 0x91, 0xbf, 0x92, 0x91, 0x55, 0xc4, 0x45, 0xad, 0x9a, 0xd0, 0xd0,
+  0x36, 0xef, 0x9e, 0x18, 0xcc, 0xad, 0x4e, 0x99, 0x4a, 0xa0, 0xd3, 0x29, 0x6c, 0x3b, 0x61, 0x6b,
+  0x61, 0x79, 0x8a, 0xf8, 0xa6, 0x22, 0x34, 0x75, 0x6e, 0xa9, 0x5d, 0x6e, 0xdd, 0x08, 0xe1, 0x69,
+  0xa9, 0xdb, 0x91, 0xd0, 0x2f, 0x5b, 0x8f, 0xb1, 0x70, 0x4a, 0x14, 0x7d, 0x0b, 0xf9, 0xd3, 0xd1,
+  0xa8, 0xc5, 0xbc, 0xc7, 0x99, 0x18, 0x45, 0x03, 0x33, 0xe7, 0xd8, 0x4c, 0x80, 0x77, 0x1b, 0x21,
+  0x08, 0xd7, 0xd8, 0x99, 0xb4, 0xc6, 0xf4, 0x8b, 0x43, 0x03, 0xb0, 0x1c, 0x7b, 0xa0, 0x17, 0xe0,
+  0xf9, 0x26, 0xfb, 0x9b, 0x7d, 0xfe, 0x69, 0xa3, 0x61, 0x58, 0x2a, 0xfd, 0x58, 0x4f, 0xeb, 0x13,
+  0x43, 0x2d, 0xd8, 0x55, 0xcb, 0x4d, 0xec, 0x0c, 0x87, 0xda, 0xfe, 0x82, 0xe6, 0x57, 0xba, 0xa0,
+  0x7a, 0xa7, 0x1a, 0x98, 0x32, 0xe3, 0x69, 0xa3, 0xcc, 0x79, 0x52, 0x56, 0x5f, 0x91, 0x3b, 0xf8,
+  0x84, 0xc6, 0x55, 0x3c, 0x01, 0x74, 0x0b, 0x9f, 0xca, 0x89, 0xec, 0x99, 0x9d, 0xc8, 0x5e, 0xd9,
+  0x76, 0xc6, 0xf1, 0xd1, 0x69, 0xde, 0x44, 0x53, 0x6e, 0x72, 0x8d, 0x51, 0xaa, 0x28, 0xa7, 0x5b,
+  0xf8, 0xe7, 0x81, 0xea, 0xb0, 0xfb, 0x70, 0x75, 0xd8, 0x5f, 0x95, 0x95, 0x15, 0x82, 0x35, 0xc6,
+  0x10, 0xa3, 0xc2, 0xf1, 0x41, 0xb1, 0xba, 0xd5, 0x46, 0x8f, 0x3a, 0x5b, 0x8d, 0xaa, 0x5c, 0xa9,
+  0xaa, 0x49, 0xe9, 0x16, 0xfe, 0x79, 0x51, 0xc5, 0x2e, 0xeb, 0x95, 0xd8, 0x65, 0xa8, 0x81, 0xba,
+  0xaa, 0x59, 0xd6, 0xab, 0x8c, 0x73, 0x5b, 0xeb, 0xbf, 0x3e, 0xc1, 0xd6, 0xaa, 0x60, 0x99, 0xf8,
+  0xd8, 0x60, 0xf4, 0x34, 0x41, 0x47, 0x81, 0x3e, 0xeb, 0xf5, 0xb9, 0x6a, 0xab, 0x64, 0xee, 0x3c,
+  0xa5, 0xf4, 0x77, 0x40, 0xfa, 0xa7, 0xff, 0x7a, 0xd2, 0xbf, 0xb1, 0xb9, 0xd5, 0xdb, 0xdf, 0xf8,
+  0x9a, 0x0b, 0x40, 0xa6, 0x54, 0x2f, 0x4d, 0xfd, 0xe4, 0x85, 0xa3, 0x0a, 0x17, 0x2b, 0xaf, 0x96,
+  0x0e, 0xb0, 0x6b, 0xfa, 0x57, 0xae, 0x96, 0x3c, 0xe6, 0x95, 0xd7, 0x8c, 0x8e, 0x1f, 0x0f, 0x5b,
+  0x33, 0x3f, 0x76, 0x60, 0xdf, 0xe8, 0xe3, 0x5f, 0x5b, 0x9d, 0x0a, 0x4b, 0x66, 0xfd, 0x07, 0x72,
+  0x7c, 0x7a, 0x71, 0x79, 0xfe, 0xcb, 0xf0, 0x90, 0x9c, 0xbe, 0x19, 0x1d, 0x1f, 0x90, 0x83, 0xf3,
+  0xb3, 0xab, 0xcb, 0xf3, 0x13, 0x72, 0xb1, 0x77, 0x36, 0x3c, 0x21, 0x3f, 0xac, 0xa7, 0xb3, 0x9b,
+  0x2f, 0x43, 0xb0, 0x36, 0x44, 0x02, 0x6b, 0x75, 0xab, 0x2c, 0xde, 0xa5, 0x5b, 0x1b, 0x6a, 0x56,
+  0xf7, 0x61, 0xb1, 0x27, 0x0d, 0x20, 0x6d, 0xf0, 0x69, 0x4f, 0x91, 0xe6, 0xc4, 0xce, 0xea, 0x75,
+  0xcc, 0xeb, 0x88, 0x23, 0x0c, 0x34, 0x1c, 0x3c, 0xc4, 0xd2, 0x12, 0xca, 0x00, 0xd3, 0xfc, 0x38,
+  0xbb, 0x44, 0x2b, 0xf4, 0x4d, 0xde, 0x2a, 0xb6, 0x64, 0xf6, 0x52, 0x61, 0x53, 0x99, 0xf3, 0xe8,
+  0x8c, 0x6b, 0x32, 0xcd, 0xfd, 0x46, 0xe5, 0x98, 0xc6, 0x23, 0x23, 0x3f, 0xab, 0x59, 0x8b, 0x1a,
+  0xf9, 0xd1, 0xd9, 0x8c, 0xb1, 0x9c, 0x74, 0xaa, 0x40, 0x63, 0x50, 0x4a, 0x0d, 0xc7, 0x5e, 0x89,
+  0xe1, 0xd8, 0x7d, 0xa8, 0xe1, 0x68, 0xaa, 0xbf, 0x31, 0xfb, 0xce, 0x0c, 0x70, 0xcc, 0xc2, 0x2e,
+  0x2e, 0x5d, 0xf8, 0xbf, 0xbf, 0x6a, 0x42, 0x99, 0x4f, 0x5e, 0x24, 0x96, 0x4c, 0xb5, 0x1e, 0x71,
+  0xb0, 0xbc, 0x5b, 0x9c, 0x54, 0x2e, 0x8f, 0x8e, 0x64, 0x46, 0xfb, 0xf3, 0x52, 0xcb, 0x85, 0x99,
+  0xe5, 0x8d, 0x07, 0x65, 0x96, 0x35, 0xfc, 0xd2, 0x32, 0xa4, 0xf7, 0x18, 0x86, 0xac, 0x9a, 0x96,
+  0xde, 0xfa, 0x57, 0xcc, 0x4a, 0xf7, 0x56, 0x20, 0xd8, 0x57, 0xc8, 0x4d, 0x1b, 0x83, 0x85, 0xbd,
+  0x47, 0x55, 0x14, 0xc1, 0x66, 0xb2, 0xa1, 0x31, 0x8d, 0xfe, 0x84, 0xdc, 0x74, 0xff, 0x69, 0x72,
+  0xd3, 0xe5, 0x64, 0x7f, 0x78, 0xb6, 0x2c, 0x4b, 0xa7, 0xcd, 0xfe, 0xc6, 0x8f, 0x55, 0x70, 0x19,
+  0x2f, 0x61, 0xb5, 0x7b, 0x61, 0x79, 0xc5, 0xda, 0xaa, 0x0e, 0x74, 0x7f, 0xe5, 0x2c, 0x2c, 0x7f,
+  0x53, 0xa4, 0x2a, 0x3b, 0xd5, 0x54, 0xe5, 0x9f, 0x93, 0x9d, 0xd5, 0x99, 0x3a, 0x59, 0xaa, 0x3f,
+  0x22, 0x89, 0x5b, 0x18, 0x77, 0x59, 0xdd, 0x1b, 0xe9, 0x17, 0x78, 0x23, 0xab, 0x6f, 0xa2, 0x15,
+  0x82, 0x9f, 0xf9, 0xc8, 0xda, 0x57, 0xaf, 0x5e, 0x5d, 0x25, 0x35, 0x9d, 0x48, 0x49, 0x55, 0xd7,
+  0x46, 0xa7, 0x76, 0x0c, 0xae, 0x4d, 0xbf, 0xc4, 0xb5, 0x31, 0xa4, 0xb1, 0x07, 0x8d, 0xaa, 0x28,
+  0x3f, 0x59, 0x1e, 0x3b, 0x01, 0xa9, 0xb5, 0x29, 0x84, 0x31, 0xc0, 0x4b, 0xff, 0x56, 0x15, 0x40,
+  0xd9, 0x52, 0xe8, 0x19, 0x32, 0xaa, 0x65, 0x62, 0x37, 0x28, 0x8b, 0xfa, 0x85, 0xbe, 0x77, 0x0d,
+  0x7e, 0xc4, 0xd4, 0x2f, 0xb1, 0xc0, 0xf8, 0x1c, 0xba, 0x05, 0x69, 0x8b, 0x0a, 0x6e, 0x0c, 0xe3,
+  0x56, 0x6f, 0x80, 0x01, 0x91, 0xe4, 0x2f, 0xa0, 0x71, 0x63, 0xc5, 0x08, 0x84, 0xba, 0xd3, 0x6c,
+  0xad, 0x5c, 0x4f, 0x86, 0xd3, 0xc6, 0x13, 0x1e, 0x78, 0x3a, 0x22, 0x2f, 0x06, 0x2b, 0xf0, 0x65,
+  0xf3, 0x61, 0x99, 0x6e, 0x65, 0x1d, 0x14, 0x90, 0x71, 0x0e, 0xc4, 0x37, 0x17, 0xe9, 0xff, 0x09,
+  0x05, 0xed, 0xe2, 0x10, 0x89, 0xf0, 0x32, 0xd2, 0x30, 0x88, 0x6d, 0xdb, 0xc5, 0x0e, 0x49, 0x79,
+  0xe5, 0x15, 0x72, 0xc1, 0xa6, 0x20, 0x76, 0x6e, 0xf8, 0x75, 0xac, 0xf1, 0x42, 0x6b, 0x5b, 0x5b,
+  0x80, 0xa5, 0xc5, 0xf3, 0xc6, 0x59, 0x50, 0xf4, 0xb6, 0x9d, 0x89, 0xa5, 0x16, 0x25, 0x3f, 0xa6,
+  0xf0, 0x57, 0xe3, 0xb4, 0x19, 0x52, 0xd6, 0x4a, 0xd1, 0x6f, 0x9c, 0x52, 0x5e, 0x61, 0x33, 0x56,
+  0x75, 0xb2, 0xc2, 0xc3, 0xdc, 0xe2, 0xeb, 0x97, 0x56, 0x72, 0xb9, 0x7e, 0x18, 0x47, 0x8b, 0xc2,
+  0x87, 0xa6, 0x49, 0x7b, 0xa6, 0x34, 0xa9, 0xfa, 0x22, 0xae, 0xb9, 0x30, 0xda, 0x20, 0xfd, 0xa7,
+  0xb0, 0x41, 0xa6, 0xd3, 0xcd, 0xf1, 0xe6, 0xf8, 0xf1, 0x99, 0xd5, 0xc2, 0x32, 0xe2, 0xbf, 0xf6,
+  0xa0, 0x4a, 0x12, 0x3d, 0xda, 0xac, 0x96, 0x16, 0x8a, 0xab, 0x24, 0x4b, 0xc2, 0x14, 0xab, 0x56,
+  0x4b, 0x27, 0x55, 0x9c, 0xcc, 0xbf, 0xd7, 0xba, 0xf9, 0x0f, 0xaa, 0x93, 0x94, 0x94, 0xaa, 0xd9,
+  0x17, 0xcf, 0xe9, 0xb6, 0x15, 0x43, 0xbc, 0x76, 0x60, 0x5d, 0xb7, 0x66, 0x96, 0x67, 0x2b, 0xf4,
+  0xa8, 0x24, 0xf4, 0x5d, 0x43, 0x00, 0xb1, 0xd2, 0x59, 0x80, 0x5f, 0x0b, 0x34, 0x42, 0x81, 0x7d,
+  0xfe, 0xd0, 0x2d, 0xfa, 0xc7, 0x46, 0x75, 0x2d, 0xb1, 0xf2, 0x89, 0x8f, 0xa9, 0xe3, 0xa2, 0x72,
+  0x5d, 0x2c, 0xa3, 0x16, 0x3f, 0xc8, 0x67, 0xda, 0x0a, 0xb2, 0xeb, 0x4b, 0x9b, 0xe5, 0x67, 0x7e,
+  0x58, 0x0b, 0xa7, 0xb4, 0x78, 0xda, 0xfa, 0xb0, 0xc2, 0x45, 0xa7, 0x41, 0xe5, 0xdf, 0xe6, 0xd4,
+  0x76, 0x2c, 0x52, 0x97, 0xea, 0xc4, 0x36, 0x31, 0xd2, 0xdb, 0xc8, 0xa1, 0x55, 0x74, 0xb6, 0x48,
+  0xd6, 0x77, 0x2a, 0x53, 0x33, 0x4a, 0x4f, 0x7d, 0x7d, 0x9f, 0xf9, 0x96, 0x1d, 0xb3, 0xa8, 0x60,
+  0xf8, 0x81, 0x3e, 0xa9, 0x21, 0xb1, 0x5b, 0x86, 0x89, 0xa9, 0x10, 0x58, 0x9a, 0xfa, 0xc6, 0xa0,
+  0x68, 0xe6, 0xea, 0xdb, 0xa2, 0xe1, 0x0a, 0x72, 0xdc, 0x05, 0xf3, 0x86, 0xd9, 0x56, 0x1f, 0xa2,
+  0x3c, 0xc1, 0x90, 0x41, 0xbf, 0xa7, 0xe5, 0x6b, 0x9a, 0x66, 0xe8, 0xad, 0xc4, 0xd8, 0x4a, 0x21,
+  0x55, 0x59, 0xed, 0x6e, 0xa9, 0xea, 0xb6, 0x32, 0x7c, 0x9d, 0xc3, 0x53, 0xea, 0xb7, 0xdc, 0x97,
+  0x24, 0x72, 0x4e, 0xfd, 0x31, 0xa8, 0x03, 0x82, 0x35, 0x7d, 0x73, 0xe7, 0x8b, 0xc5, 0x0a, 0x26,
+  0x41, 0xf7, 0x81, 0xca, 0x5c, 0x4e, 0x66, 0x72, 0x26, 0x27, 0x5e, 0x60, 0xcc, 0xf9, 0xe4, 0xba,
+  0x41, 0x59, 0x5b, 0x52, 0xfa, 0x4d, 0xeb, 0xf0, 0xad, 0x90, 0xfc, 0x2d, 0xb6, 0x00, 0x2a, 0x89,
+  0xb8, 0x19, 0x87, 0x32, 0xc7, 0xb3, 0x1a, 0x5b, 0x9e, 0x70, 0x08, 0x3d, 0x6f, 0x5e, 0x1f, 0x1f,
+  0x1e, 0x0e, 0xcf, 0xc8, 0xde, 0x9b, 0xc3, 0xe3, 0x73, 0x32, 0x3c, 0x19, 0x9e, 0x0e, 0xcf, 0xae,
+  0x32, 0xc9, 0x35, 0xae, 0xbe, 0x5b, 0xd6, 0xd2, 0x76, 0xfc, 0x55, 0x94, 0xf8, 0xcb, 0x75, 0x71,
+  0x08, 0xfe, 0xe5, 0x3a, 0x3f, 0xa0, 0xff, 0x12, 0x4f, 0x92, 0x8b, 0xf3, 0xf1, 0xb6, 0xf3, 0x99,
+  0x4c, 0x5c, 0x2b, 0x0c, 0x77, 0xd6, 0xf8, 0x41, 0xec, 0xb5, 0xf4, 0xb0, 0xfc, 0x4b, 0xae, 0xf0,
+  0xe3, 0xf7, 0xe2, 0x38, 0xea, 0x1a, 0x71, 0xec, 0x9d, 0x35, 0x46, 0xf7, 0x0b, 0xa6, 0x57, 0xf7,
+  0xf1, 0x19, 0x33, 0x5c, 0x76, 0xd6, 0xde, 0xb2, 0xa2, 0x45, 0xfe, 0x7c, 0x6d, 0xf7, 0xed, 0xcb,
+  0x75, 0x0e, 0xa2, 0x1a, 0xcc, 0xc8, 0xbf, 0xbe, 0x76, 0xa9, 0x0c, 0xee, 0xc2, 0xbf, 0x41, 0x38,
+  0xff, 0xfc, 0xaf, 0xff, 0xce, 0x42, 0x7a, 0xb9, 0x0e, 0x78, 0xf3, 0x8f, 0xca, 0x34, 0xf4, 0x87,
+  0x5c, 0xe5, 0x69, 0x19, 0x1a, 0x2b, 0x13, 0x93, 0xfa, 0xe8, 0xfb, 0xc5, 0xe7, 0x28, 0xd7, 0x76,
+  0x25, 0x84, 0x72, 0xf8, 0x15, 0xa1, 0xaa, 0x1e, 0xfa, 0x33, 0xa0, 0x29, 0xeb, 0x84, 0x3c, 0x56,
+  0xe0, 0x9f, 0x79, 0xbb, 0xfb, 0x09, 0x24, 0xe0, 0x36, 0x3e, 0x50, 0xdb, 0xb0, 0xd9, 0xa5, 0x23,
+  0xfe, 0x62, 0xb9, 0x4b, 0xba, 0xb6, 0x0b, 0x76, 0x4e, 0xbe, 0x47, 0x7e, 0x2e, 0xcc, 0x78, 0x20,
+  0xd1, 0xdd, 0x02, 0x18, 0x02, 0x72, 0x7e, 0x4d, 0xd7, 0xd0, 0x6b, 0xde, 0x59, 0xeb, 0xac, 0x61,
+  0x9d, 0xf6, 0xce, 0x5a, 0xb7, 0x03, 0x9f, 0x3e, 0x23, 0xb8, 0x9d, 0xb5, 0x01, 0x7c, 0xcc, 0xe0,
+  0xbc, 0x96, 0x1b, 0x76, 0xc4, 0x9f, 0x96, 0xd3, 0x26, 0x7b, 0x3a, 0xc9, 0x44, 0x17, 0xf9, 0x70,
+  0xd1, 0xda, 0xee, 0x05, 0xeb, 0x93, 0xc7, 0x5f, 0x05, 0xca, 0xb7, 0xe6, 0x3c, 0x21, 0xb3, 0x92,
+  0x99, 0x28, 0x96, 0x35, 0xc2, 0x96, 0x0f, 0x4c, 0x42, 0x17, 0x74, 0x1b, 0xf4, 0x06, 0xbd, 0x17,
+  0xc8, 0xff, 0xbc, 0xa0, 0x3f, 0x1c, 0xe4, 0x4f, 0x5b, 0x60, 0xc6, 0x3f, 0x2d, 0xc8, 0xe1, 0x7e,
+  0x7f, 0xff, 0x49, 0x41, 0x6e, 0x1c, 0xec, 0x1d, 0x0d, 0x9e, 0x16, 0xcb, 0x5e, 0xf7, 0xa7, 0xcd,
+  0xa3, 0xfe, 0x93, 0x82, 0xfc, 0xe9, 0xa0, 0xf7, 0xe3, 0xbe, 0x1e, 0xcb, 0x8a, 0x2b, 0xf4, 0x21,
+  0x52, 0x78, 0x80, 0x4f, 0x9d, 0xc9, 0x9f, 0x28, 0x86, 0xc3, 0x9f, 0xba, 0xc3, 0xcd, 0xfe, 0x13,
+  0xcb, 0xcc, 0xe0, 0xc7, 0xde, 0xd3, 0x4a, 0xf6, 0xc1, 0xe1, 0xe1, 0x41, 0xff, 0xa7, 0x27, 0x05,
+  0xd9, 0xe9, 0xec, 0x1f, 0x1c, 0x6e, 0x3c, 0x29, 0xc8, 0xfe, 0xd1, 0xa0, 0xbb, 0x3f, 0x78, 0x52,
+  0x90, 0x9b, 0x3f, 0xf6, 0xf7, 0xf6, 0x7f, 0x7c, 0x8c, 0x18, 0xea, 0xce, 0x73, 0x71, 0xcd, 0xca,
+  0xde, 0xf0, 0xed, 0xea, 0x5c, 0x3c, 0xd7, 0xcb, 0x9c, 0x7a, 0x06, 0x69, 0x6d, 0x77, 0xc4, 0xf6,
+  0x2f, 0xc2, 0x37, 0xed, 0x2b, 0xb0, 0xcc, 0x69, 0x60, 0x45, 0xcb, 0x80, 0x16, 0x88, 0x6e, 0xe6,
+  0x90, 0x50, 0xc1, 0x06, 0x29, 0xb7, 0x13, 0x98, 0x5a, 0xc1, 0x9c, 0x8d, 0x94, 0xeb, 0xa5, 0xef,
+  0xc9, 0x8f, 0x79, 0xa4, 0x87, 0x2e, 0x94, 0x2d, 0xd6, 0xdc, 0x55, 0x2c, 0xc3, 0xb7, 0xd0, 0x97,
+  0x4f, 0x4d, 0xd3, 0x53, 0xf7, 0xa8, 0x10, 0x7b, 0x3c, 0x92, 0xb1, 0x2a, 0xf6, 0xe9, 0x31, 0x8e,
+  0xd5, 0xb1, 0x3f, 0x80, 0xbe, 0x55, 0xb1, 0xcf, 0x7f, 0xcd, 0x8a, 0x68, 0x5c, 0x9b, 0x2f, 0x76,
+  0x62, 0xf8, 0x76, 0x14, 0xf8, 0x31, 0x27, 0xf6, 0xe1, 0x6b, 0x75, 0xd3, 0x2a, 0x53, 0xcc, 0xcd,
+  0xe1, 0x89, 0x47, 0x17, 0xec, 0x89, 0x11, 0x07, 0x25, 0x8e, 0x29, 0x88, 0x8a, 0x8f, 0x87, 0xfc,
+  0x29, 0x9a, 0x7d, 0xbb, 0xfb, 0x9a, 0x15, 0xa2, 0x19, 0x5f, 0x88, 0x2f, 0xde, 0xfb, 0x24, 0x7a,
+  0xe7, 0x48, 0x50, 0xd8, 0x3b, 0x13, 0x6b, 0x43, 0x4a, 0x23, 0xaf, 0x04, 0x1c, 0x52, 0xef, 0xb6,
+  0x36, 0x3b, 0x8d, 0x82, 0x05, 0x20, 0x3b, 0xb9, 0x19, 0x12, 0xbc, 0xc2, 0x07, 0x39, 0x3e, 0x7d,
+  0xd3, 0x6a, 0x25, 0x90, 0x11, 0x30, 0x78, 0xdd, 0xae, 0x4b, 0xc6, 0x94, 0x58, 0x60, 0xca, 0xdb,
+  0xc4, 0xbe, 0xf3, 0xac, 0xb9, 0x03, 0x0e, 0x83, 0x7b, 0x47, 0x5a, 0x2d, 0x23, 0x43, 0x57, 0x99,
+  0xcd, 0x9e, 0x6d, 0xb3, 0xe0, 0x98, 0xe5, 0xa6, 0x53, 0xda, 0xec, 0xb6, 0xb6, 0x56, 0x9c, 0x93,
+  0x95, 0x80, 0x19, 0x56, 0x9b, 0x1d, 0x1b, 0xe3, 0xeb, 0x4f, 0x8f, 0xab, 0xaa, 0x64, 0x66, 0x5b,
+  0x30, 0xea, 0x60, 0xb5, 0x99, 0xb1, 0x55, 0x56, 0x32, 0xa9, 0xec, 0x28, 0x6c, 0x90, 0xaf, 0x3f,
+  0xb5, 0xe1, 0x2d, 0x78, 0x91, 0xd2, 0xd4, 0x36, 0xf1, 0x20, 0xca, 0x8a, 0x92, 0x88, 0x20, 0xca,
+  0x18, 0x96, 0x19, 0x86, 0x8f, 0xb2, 0xfa, 0xe4, 0x14, 0x2d, 0x81, 0xa0, 0x0b, 0xcb, 0x44, 0x63,
+  0x40, 0xf2, 0x0c, 0x34, 0xd1, 0x1c, 0x3e, 0x11, 0xf6, 0x42, 0x5c, 0xe9, 0xa6, 0xa8, 0x16, 0x09,
+  0x80, 0x14, 0x24, 0x56, 0x7d, 0x30, 0x65, 0x20, 0xa9, 0x12, 0x70, 0x6d, 0xf7, 0x14, 0x1f, 0xc5,
+  0xd7, 0xc6, 0x11, 0x36, 0x88, 0x91, 0x79, 0x38, 0xb9, 0x73, 0x70, 0x61, 0x1c, 0x5c, 0x56, 0x3d,
+  0xc2, 0x3d, 0x9b, 0x30, 0x4b, 0x1b, 0x65, 0xb4, 0x7c, 0x9c, 0xa8, 0x60, 0xb3, 0x54, 0x03, 0x3f,
+  0xba, 0x5d, 0x86, 0x79, 0x69, 0x5c, 0x5b, 0x1d, 0x52, 0x2c, 0x9e, 0xb8, 0xd3, 0xf9, 0x7a, 0x59,
+  0x7f, 0xcf, 0xe6, 0x0d, 0xcd, 0xce, 0x9e, 0x69, 0x33, 0x7c, 0xa0, 0xd3, 0x27, 0xcf, 0x64, 0x4d,
+  0xc6, 0x20, 0xe3, 0xf7, 0x55, 0x5d, 0x29, 0x5f, 0x9f, 0x90, 0x97, 0xfe, 0xf2, 0x7a, 0x66, 0x72,
+  0x9b, 0xb3, 0xa4, 0x0c, 0xe2, 0xa6, 0x7f, 0x21, 0x31, 0x13, 0x1c, 0xaa, 0x93, 0x13, 0x65, 0xf7,
+  0x6c, 0xf8, 0x76, 0x1b, 0xe4, 0x56, 0xda, 0x1b, 0x46, 0x7f, 0xa1, 0x08, 0x73, 0xdd, 0x43, 0x46,
+  0x0b, 0x4a, 0xed, 0x72, 0xb2, 0x73, 0x2d, 0xc7, 0x1a, 0xff, 0x85, 0x84, 0x97, 0xb0, 0xf8, 0x7f,
+  0x4e, 0x92, 0x5f, 0xb9, 0xfe, 0x8d, 0xe3, 0x5d, 0x57, 0x25, 0xe8, 0x35, 0x6f, 0xfe, 0x57, 0x53,
+  0x54, 0x46, 0x63, 0x35, 0x69, 0xce, 0x6a, 0xee, 0x7d, 0x5e, 0x1c, 0x58, 0x22, 0xc9, 0x4a, 0x09,
+  0x61, 0x01, 0xe9, 0xe5, 0x34, 0x97, 0x8e, 0xe8, 0x59, 0xd3, 0x36, 0x89, 0x0e, 0x4b, 0x3b, 0xd7,
+  0x91, 0x93, 0x0d, 0x63, 0xe2, 0x77, 0x72, 0x6a, 0x79, 0xd6, 0x35, 0x0e, 0x7c, 0xa4, 0xf7, 0x2c,
+  0x0d, 0x88, 0x47, 0x49, 0x5c, 0x01, 0xa1, 0xac, 0xee, 0xca, 0x3c, 0x7e, 0x36, 0x57, 0x4a, 0x58,
+  0xf6, 0x72, 0xe9, 0xad, 0x8f, 0x22, 0x1f, 0xe0, 0x5d, 0x3e, 0x70, 0x2e, 0x31, 0x84, 0xbf, 0x62,
+  0x3e, 0x5c, 0xff, 0xc8, 0xf3, 0xe1, 0x12, 0xc5, 0x9f, 0x83, 0x65, 0xf0, 0xc0, 0x39, 0xf1, 0xfe,
+  0x2b, 0xbb, 0x6b, 0x59, 0xe1, 0x1e, 0xf9, 0xb0, 0x92, 0x8f, 0x3d, 0xcc, 0x25, 0xf0, 0xf4, 0xcc,
+  0xbe, 0x7f, 0x6b, 0x94, 0x6d, 0x4d, 0x79, 0x59, 0x81, 0x5c, 0x67, 0xaa, 0xb2, 0x38, 0x3d, 0xf0,
+  0xd1, 0x19, 0x3c, 0x81, 0x41, 0x34, 0xb4, 0x3c, 0xf3, 0x09, 0x36, 0x20, 0x3c, 0xcc, 0x4d, 0xed,
+  0x55, 0xd8, 0x24, 0x17, 0x1f, 0x95, 0xec, 0x04, 0xdb, 0x92, 0x72, 0x9a, 0x2c, 0x83, 0x80, 0x7a,
+  0x51, 0xcc, 0x8a, 0xee, 0x7a, 0xb7, 0x23, 0x34, 0x53, 0xa1, 0x62, 0xdb, 0x1d, 0x45, 0x56, 0x84,
+  0xb9, 0xf2, 0x14, 0x12, 0x63, 0x0f, 0x7f, 0xbc, 0xb6, 0x8b, 0xa2, 0xb6, 0x48, 0x94, 0x63, 0x05,
+  0x5d, 0x57, 0x66, 0xea, 0xbe, 0xe6, 0xa9, 0x74, 0x4c, 0xae, 0x13, 0xae, 0x12, 0x13, 0xfb, 0x56,
+  0xd6, 0x90, 0xf8, 0x9e, 0x53, 0x1a, 0x3f, 0x1d, 0xe3, 0x9b, 0x44, 0x25, 0x2a, 0x89, 0xf9, 0x35,
+  0x62, 0x4d, 0x26, 0x74, 0x11, 0x81, 0xf7, 0x85, 0x29, 0x9e, 0xf5, 0x1f, 0xd6, 0xf2, 0xa3, 0xee,
+  0xb1, 0xd4, 0x0f, 0x70, 0x63, 0x0e, 0x34, 0x4a, 0x47, 0xe4, 0x19, 0x21, 0xe6, 0xb6, 0xe1, 0xa7,
+  0x0b, 0xd7, 0xba, 0x43, 0x2d, 0x1b, 0xa7, 0x75, 0xa4, 0xb4, 0x11, 0x1a, 0xc9, 0xec, 0xc3, 0xee,
+  0x33, 0x71, 0x3d, 0xf2, 0x24, 0x70, 0x16, 0x51, 0x3a, 0xef, 0xf5, 0x75, 0x72, 0x78, 0x7e, 0x4a,
+  0x86, 0x7c, 0x88, 0xf0, 0x59, 0x9a, 0x9c, 0xf3, 0xc2, 0x88, 0x64, 0x93, 0x3e, 0x64, 0x87, 0xd8,
+  0xfe, 0x64, 0x89, 0x0d, 0xdb, 0xd7, 0x34, 0x12, 0x7d, 0xf6, 0xef, 0x8e, 0xed, 0x7a, 0x2d, 0xdb,
+  0xb2, 0x26, 0xa5, 0xc2, 0x38, 0xa4, 0x24, 0xd5, 0x53, 0x04, 0x24, 0x69, 0xa4, 0xf6, 0x97, 0xe0,
+  0x57, 0x44, 0x43, 0x85, 0x91, 0x4f, 0x4a, 0x14, 0x01, 0xca, 0xb7, 0x2d, 0x82, 0xc6, 0x36, 0xd5,
+  0x6a, 0xc0, 0x58, 0x53, 0x15, 0x96, 0x1a, 0xd4, 0x2b, 0x02, 0xa7, 0xb6, 0xd6, 0x60, 0x27, 0x87,
+  0x7d, 0x0a, 0x71, 0x93, 0x1b, 0x6a, 0x30, 0x8b, 0x83, 0x78, 0x85, 0x08, 0xc5, 0x8d, 0x74, 0x7c,
+  0x13, 0x61, 0xb4, 0x62, 0xae, 0x89, 0x46, 0x6a, 0x7f, 0x39, 0xdc, 0x54, 0x04, 0x42, 0x6e, 0x67,
+  0x84, 0x82, 0x2e, 0x72, 0x05, 0x20, 0xd8, 0x4c, 0x85, 0xa1, 0x8d, 0x90, 0x14, 0x41, 0xd3, 0x76,
+  0x30, 0xf0, 0xbe, 0x22, 0xc8, 0x7c, 0x5b, 0xcd, 0x4c, 0x73, 0x11, 0x81, 0xc2, 0xe9, 0xe6, 0xda,
+  0x1a, 0x56, 0x1d, 0xac, 0xc7, 0x50, 0x06, 0xf3, 0xfb, 0x92, 0x06, 0x77, 0x23, 0x91, 0x09, 0xdd,
+  0x73, 0xdd, 0x7a, 0x2d, 0x4d, 0xca, 0x6b, 0x40, 0x64, 0x43, 0x7e, 0x85, 0x62, 0x90, 0x6d, 0x2a,
+  0xc3, 0x92, 0xf5, 0x55, 0x36, 0xd8, 0x20, 0x12, 0xe7, 0xa3, 0xdc, 0xb0, 0x4a, 0x40, 0xa1, 0x68,
+  0x60, 0xa5, 0xb1, 0x3a, 0x8d, 0x8c, 0x57, 0x5b, 0x04, 0x2b, 0xd3, 0xd0, 0x08, 0xa7, 0x54, 0x65,
+  0xc8, 0xed, 0x54, 0x28, 0x39, 0xb7, 0xb0, 0x08, 0x50, 0xae, 0x69, 0x01, 0xac, 0x52, 0x9c, 0xb2,
+  0x2d, 0x4d, 0xab, 0x4c, 0x32, 0xf0, 0xcb, 0xd7, 0x9a, 0xd4, 0xb8, 0x10, 0x5e, 0x29, 0x6e, 0xf9,
+  0xb6, 0x2a, 0x34, 0xd5, 0xff, 0x28, 0x82, 0xa7, 0xb6, 0x2e, 0x86, 0x58, 0x8a, 0xa0, 0xd2, 0x58,
+  0x85, 0x27, 0xbb, 0x12, 0xa5, 0xe2, 0x2a, 0xda, 0x19, 0xa0, 0x5c, 0x55, 0xd9, 0x6e, 0xb3, 0x2d,
+  0x0d, 0x90, 0x12, 0xe3, 0xb9, 0x14, 0x52, 0xd2, 0x52, 0x85, 0x24, 0x99, 0x9d, 0x45, 0x60, 0xa4,
+  0x66, 0x1a, 0x45, 0x22, 0x5b, 0x8a, 0x23, 0xb4, 0xfa, 0x8a, 0x54, 0x89, 0xdc, 0xd8, 0x30, 0x33,
+  0x6e, 0x2b, 0x96, 0x41, 0x92, 0x9a, 0xaa, 0x70, 0x12, 0x23, 0xaf, 0x08, 0x42, 0xd2, 0xc8, 0xa4,
+  0xd0, 0x32, 0x15, 0x40, 0x79, 0x45, 0x26, 0x59, 0x78, 0x85, 0x9b, 0x4d, 0xda, 0xcc, 0x34, 0x0c,
+  0x4e, 0x82, 0x3e, 0x4b, 0xab, 0x63, 0x23, 0xe2, 0x84, 0xe7, 0x38, 0xf7, 0x28, 0x58, 0x4a, 0x35,
+  0x44, 0xfc, 0x85, 0x50, 0xc3, 0xe7, 0x78, 0x16, 0x7b, 0x87, 0x4c, 0x2d, 0x37, 0x54, 0x9a, 0x30,
+  0x27, 0x8a, 0xa9, 0x4b, 0x73, 0x2b, 0x46, 0x3d, 0x44, 0x0b, 0xe3, 0x15, 0xda, 0x16, 0x82, 0x53,
+  0xa7, 0xa9, 0x04, 0x41, 0xbb, 0x4e, 0xb6, 0x4d, 0xec, 0x8f, 0x8c, 0x84, 0x7c, 0x40, 0x8b, 0xb5,
+  0xbc, 0xaf, 0xb2, 0x66, 0xee, 0xc2, 0xbc, 0xf1, 0x1d, 0xe2, 0x2d, 0x5d, 0x57, 0x4f, 0x99, 0x38,
+  0x38, 0xee, 0x3a, 0xc8, 0x53, 0x3f, 0x60, 0xa9, 0x1b, 0xbd, 0x09, 0x01, 0x70, 0xde, 0x67, 0xfc,
+  0x88, 0xb5, 0x11, 0x2b, 0x71, 0x66, 0xd1, 0xc5, 0xb5, 0x26, 0x59, 0xbb, 0x04, 0xaf, 0x6c, 0xec,
+  0xdf, 0x48, 0x1f, 0xc9, 0xc1, 0xdd, 0x04, 0xbc, 0x02, 0x78, 0xc0, 0x43, 0x90, 0x6f, 0x9d, 0x05,
+  0xfb, 0x76, 0x35, 0xa3, 0xc0, 0x90, 0x80, 0x1c, 0xcc, 0xac, 0x10, 0x1f, 0x64, 0xc1, 0xee, 0xbb,
+  0x8e, 0xf7, 0x89, 0x41, 0x59, 0x7a, 0x1e, 0x52, 0xef, 0x04, 0x6d, 0xc8, 0x10, 0x9f, 0x9c, 0xd2,
+  0x88, 0xf2, 0xc1, 0xae, 0x40, 0xa5, 0x7c, 0x12, 0xb0, 0x61, 0x10, 0x6c, 0xc6, 0xa1, 0x67, 0x61,
+  0x1d, 0x39, 0x81, 0x18, 0xdf, 0x9b, 0xd2, 0x28, 0x72, 0xf0, 0xf3, 0x05, 0xa0, 0x3d, 0x61, 0x4f,
+  0xf7, 0x2f, 0x4e, 0xf1, 0x9f, 0x11, 0xec, 0x7e, 0x63, 0xa5, 0xeb, 0x5b, 0xeb, 0x33, 0x0d, 0x79,
+  0xdf, 0x39, 0x8d, 0xd8, 0x87, 0x19, 0x45, 0xcb, 0x73, 0xec, 0x5b, 0x81, 0xcd, 0xfa, 0x2d, 0x5c,
+  0x27, 0x52, 0xe6, 0x4f, 0x8e, 0xac, 0x30, 0xca, 0x03, 0xbb, 0xa4, 0x60, 0xae, 0x86, 0x54, 0xa1,
+  0x80, 0x44, 0x33, 0x31, 0x23, 0x78, 0xe4, 0xd9, 0xfe, 0x9c, 0x21, 0xba, 0x74, 0x19, 0x79, 0x60,
+  0x20, 0x2b, 0x60, 0x93, 0xcd, 0x11, 0xca, 0x5f, 0x7a, 0x7c, 0x22, 0x47, 0x96, 0x4d, 0xc1, 0x95,
+  0x26, 0xe7, 0x4b, 0x86, 0xe8, 0xe1, 0xd2, 0x72, 0x13, 0xe2, 0x26, 0x78, 0xe1, 0x84, 0x52, 0x22,
+  0xa6, 0x43, 0xe7, 0x80, 0x06, 0x80, 0xd9, 0x8c, 0x8f, 0xea, 0x04, 0x96, 0xcb, 0x21, 0x20, 0x4a,
+  0xe4, 0x08, 0xbc, 0x2c, 0xf6, 0x66, 0xcf, 0x05, 0xdc, 0x3d, 0x98, 0x40, 0xca, 0x5a, 0x31, 0x5a,
+  0x16, 0xd6, 0xa1, 0xbf, 0x1c, 0xc3, 0x8c, 0x12, 0x02, 0xc6, 0x98, 0xa4, 0x88, 0xb3, 0x29, 0xca,
+  0x54, 0xc0, 0x70, 0x3f, 0x25, 0xc9, 0x84, 0xc5, 0x5c, 0x38, 0xea, 0x59, 0xe0, 0x6c, 0x44, 0xb5,
+  0xab, 0x24, 0x18, 0xa7, 0xfe, 0x67, 0x94, 0x8b, 0x7d, 0xd7, 0x9f, 0x7c, 0x0a, 0xe5, 0xf1, 0xd3,
+  0x99, 0x31, 0xd4, 0x4c, 0xa4, 0x40, 0x46, 0x92, 0x3c, 0x13, 0xe4, 0x11, 0x13, 0x3a, 0xc8, 0x0f,
+  0x47, 0xae, 0x44, 0xeb, 0x2b, 0xf0, 0x39, 0x91, 0x02, 0x3a, 0xea, 0xf0, 0x42, 0x36, 0x19, 0xe1,
+  0x18, 0xbf, 0x64, 0x4c, 0x31, 0x83, 0x43, 0x5f, 0x88, 0xff, 0xd2, 0x8d, 0x1c, 0x99, 0x38, 0x38,
+  0x8c, 0x09, 0x7b, 0x4e, 0x1f, 0xdd, 0xe4, 0x93, 0xee, 0x29, 0xfe, 0x69, 0x33, 0x2e, 0x3b, 0x31,
+  0xc7, 0xd8, 0x64, 0x38, 0x3a, 0x09, 0xf4, 0x0f, 0x06, 0x5d, 0x9e, 0x86, 0xdc, 0x69, 0x5e, 0xab,
+  0xb0, 0x94, 0x69, 0x99, 0x57, 0xa1, 0x2a, 0x18, 0x1e, 0xac, 0xfa, 0xc5, 0x09, 0x01, 0x27, 0xe7,
+  0x0b, 0xcd, 0xae, 0xb2, 0x64, 0x65, 0xb3, 0x2c, 0x91, 0x25, 0x04, 0xea, 0xd4, 0x8a, 0x02, 0xe7,
+  0x96, 0xd1, 0x04, 0xbf, 0xbe, 0xb2, 0x5c, 0xeb, 0xf6, 0x0e, 0x19, 0xee, 0xe5, 0xe9, 0x33, 0xf4,
+  0x68, 0x70, 0x7d, 0x97, 0xd2, 0xfa, 0x2d, 0x5f, 0x90, 0xce, 0x62, 0xc1, 0x89, 0xf3, 0x9a, 0x5a,
+  0x41, 0x44, 0xf6, 0x61, 0x35, 0xf0, 0xb5, 0x1f, 0xc0, 0x64, 0xe6, 0x56, 0x28, 0x69, 0x23, 0x44,
+  0xe1, 0xc6, 0x0f, 0x90, 0x6e, 0x59, 0xd0, 0xa0, 0xf6, 0xc3, 0xb9, 0x45, 0xf6, 0x2d, 0x97, 0x09,
+  0xd9, 0x89, 0xf5, 0xd9, 0x22, 0x27, 0xd6, 0x7c, 0xc1, 0x68, 0xbe, 0x0c, 0xfc, 0x00, 0xde, 0xf9,
+  0xb0, 0xce, 0x80, 0x3e, 0xf8, 0xe8, 0x7c, 0x42, 0x61, 0x27, 0x4e, 0xf4, 0xcd, 0x21, 0x0d, 0x29,
+  0x8c, 0x3c, 0x5a, 0x82, 0x38, 0x2b, 0x8a, 0xe4, 0xcc, 0x0f, 0xa2, 0x19, 0x30, 0x4d, 0x42, 0x23,
+  0xa6, 0xc8, 0x95, 0x0f, 0xbc, 0xb4, 0xfd, 0x94, 0x28, 0xd2, 0x83, 0x58, 0x78, 0x47, 0xe0, 0xb8,
+  0xcc, 0xe5, 0x4e, 0xc3, 0xdb, 0x05, 0xf8, 0x1e, 0x58, 0xfb, 0x51, 0xc6, 0x5f, 0xee, 0xcb, 0x2a,
+  0xac, 0x65, 0x29, 0xe3, 0x02, 0xc7, 0x4e, 0xe5, 0x2a, 0xab, 0x56, 0xc1, 0x48, 0x3e, 0xc7, 0x14,
+  0x53, 0x92, 0x09, 0x0f, 0xd8, 0x18, 0xb1, 0x3e, 0xc6, 0x1d, 0x66, 0x1a, 0x11, 0x54, 0x6e, 0xac,
+  0x29, 0x3f, 0x21, 0xc3, 0x26, 0x5e, 0x8a, 0x2d, 0xcf, 0xfd, 0xaa, 0xd8, 0xb2, 0x24, 0x70, 0x81,
+  0xe7, 0xa8, 0xa2, 0x7b, 0x02, 0xcb, 0x28, 0x20, 0xa3, 0x89, 0xc5, 0x04, 0xea, 0xd0, 0xb9, 0x76,
+  0x22, 0x10, 0xf1, 0x58, 0xc0, 0xc4, 0xc6, 0x36, 0xa3, 0x94, 0xb1, 0xfa, 0x02, 0x64, 0xc6, 0x81,
+  0x3d, 0x0f, 0x74, 0x25, 0x9f, 0xdf, 0xeb, 0xbb, 0x85, 0xe7, 0xc3, 0xa3, 0x44, 0xe7, 0xe4, 0x74,
+  0x80, 0xe3, 0x59, 0xc1, 0x1d, 0xac, 0xb7, 0x25, 0x1e, 0x04, 0x49, 0x01, 0x8e, 0xee, 0xe6, 0x8b,
+  0x99, 0xef, 0xdd, 0xe1, 0x93, 0x33, 0xea, 0x7b, 0x29, 0x89, 0x5e, 0x89, 0x5b, 0x2d, 0x92, 0x11,
+  0x2e, 0x9c, 0x5b, 0xf0, 0xf1, 0xc4, 0x02, 0xc8, 0xa9, 0x00, 0x06, 0xeb, 0x17, 0x10, 0x19, 0x7a,
+  0x2b, 0x33, 0x3d, 0x15, 0x72, 0xb1, 0x5c, 0x0e, 0x7c, 0x41, 0xe2, 0xbb, 0x31, 0xcc, 0x35, 0x55,
+  0x79, 0x91, 0x15, 0xc0, 0x42, 0xa3, 0xae, 0x5d, 0x4a, 0x6f, 0x39, 0xae, 0x8c, 0x6b, 0x04, 0xc8,
+  0x5a, 0xef, 0x76, 0x62, 0x06, 0x34, 0xcc, 0xf6, 0xb5, 0x86, 0xe2, 0xb8, 0xe6, 0x52, 0x24, 0x04,
+  0x85, 0x85, 0x42, 0x05, 0x2f, 0x62, 0x02, 0x56, 0xdb, 0x9c, 0xec, 0x81, 0xe2, 0xb8, 0x13, 0x3a,
+  0x61, 0xdf, 0x0a, 0x43, 0x72, 0x49, 0xad, 0x49, 0xc4, 0x75, 0x2e, 0xc5, 0x5d, 0x47, 0x4b, 0x11,
+  0xb1, 0xe8, 0x63, 0xda, 0x5d, 0xce, 0xee, 0xa2, 0x99, 0xb4, 0xb1, 0xbd, 0x06, 0xd1, 0x04, 0xaa,
+  0x27, 0xd2, 0x89, 0x85, 0x62, 0x7e, 0xba, 0x93, 0x1e, 0x05, 0xf4, 0xf7, 0x25, 0xf5, 0x26, 0x77,
+  0x15, 0x55, 0xe2, 0xdb, 0xe1, 0xfe, 0xe8, 0xfc, 0xe0, 0xef, 0xc3, 0xab, 0xc4, 0x67, 0x3f, 0x78,
+  0xbd, 0x77, 0x76, 0x36, 0x3c, 0x91, 0x1b, 0x81, 0xae, 0x9d, 0x83, 0x64, 0x03, 0x65, 0x6c, 0x1a,
+  0x92, 0xb9, 0x15, 0x4d, 0x66, 0xf1, 0xb3, 0xab, 0xbb, 0x05, 0xc6, 0x5c, 0x09, 0xac, 0x78, 0x30,
+  0xb8, 0x83, 0xf9, 0x8d, 0x15, 0xd0, 0x1c, 0x25, 0x0f, 0x4e, 0x0f, 0x81, 0x80, 0xd9, 0x12, 0xf9,
+  0x83, 0xf3, 0x93, 0xf3, 0xcb, 0x6d, 0xd2, 0x69, 0x92, 0xfd, 0xcb, 0xe3, 0x57, 0xaf, 0xaf, 0xce,
+  0x86, 0xa3, 0xd1, 0x36, 0xe9, 0x36, 0xc9, 0xc5, 0xf9, 0xdb, 0x21, 0xbc, 0xe8, 0x35, 0xc9, 0xf0,
+  0xe8, 0x68, 0x78, 0x70, 0xb5, 0x4d, 0xfa, 0x4d, 0x1e, 0x54, 0xf8, 0xed, 0xe2, 0x64, 0xef, 0xdd,
+  0x36, 0xd9, 0x88, 0xbf, 0x8e, 0xae, 0xce, 0x2f, 0xb6, 0xc9, 0x20, 0x4b, 0x3d, 0xfe, 0x2a, 0xee,
+  0xba, 0xd9, 0x24, 0x87, 0xc3, 0xb3, 0xd1, 0xf1, 0x15, 0xf4, 0xfb, 0xb1, 0x49, 0x2e, 0xcf, 0xdf,
+  0xbc, 0x7a, 0xcd, 0x47, 0xda, 0x8a, 0xe1, 0xff, 0x36, 0xba, 0x18, 0x0e, 0x0f, 0xb7, 0xc9, 0x4f,
+  0x4d, 0xf2, 0xea, 0xe4, 0xfc, 0xed, 0xf1, 0xd9, 0xab, 0xf8, 0x49, 0x17, 0x90, 0xbb, 0x80, 0xef,
+  0xf0, 0xa9, 0x9b, 0x1d, 0x84, 0xb9, 0x04, 0xbf, 0x1d, 0x5d, 0xee, 0x9d, 0x0e, 0xf1, 0xd8, 0x47,
+  0x93, 0x5c, 0x1d, 0x9f, 0x0e, 0x4f, 0x8e, 0xcf, 0x86, 0x02, 0xc5, 0x6e, 0x3f, 0xad, 0xf9, 0xcf,
+  0x19, 0xbe, 0xb0, 0x85, 0xd1, 0xc8, 0x6c, 0xee, 0x4e, 0xc1, 0xe8, 0x60, 0x79, 0x06, 0xa0, 0x9c,
+  0x87, 0x9e, 0x14, 0x6b, 0x5f, 0xcf, 0x1f, 0xf6, 0x48, 0xc1, 0x50, 0xd8, 0xc7, 0xe9, 0x58, 0x34,
+  0xfb, 0x78, 0x13, 0x6e, 0xaf, 0xaf, 0x7f, 0xfb, 0x07, 0x6c, 0x94, 0x2c, 0x5b, 0xd1, 0x9e, 0xf9,
+  0x61, 0x74, 0xbf, 0x7e, 0x13, 0x7e, 0xcc, 0x1d, 0x7e, 0xe0, 0xfd, 0xdb, 0x63, 0xb6, 0xb2, 0x19,
+  0x07, 0x77, 0x48, 0xcd, 0x0a, 0x02, 0xeb, 0x6e, 0xbc, 0x04, 0x89, 0x0f, 0x6a, 0xda, 0xe6, 0xbe,
+  0xe7, 0x73, 0x57, 0x02, 0xf0, 0xd9, 0xd9, 0xd5, 0x9c, 0xbb, 0x40, 0x76, 0xfb, 0x2e, 0x6d, 0xbb,
+  0xfe, 0x75, 0xbd, 0x16, 0x67, 0x04, 0x05, 0xae, 0x62, 0x42, 0x34, 0x13, 0xc7, 0x4a, 0x06, 0xa0,
+  0x9e, 0x7d, 0x01, 0x56, 0x44, 0x3d, 0x7f, 0x48, 0xc3, 0x80, 0x07, 0x8b, 0x45, 0x15, 0x20, 0x02,
+  0x22, 0xfb, 0x77, 0x4a, 0x17, 0xe0, 0x3b, 0x31, 0xd7, 0xa6, 0x05, 0xa3, 0x33, 0x61, 0x0d, 0xc9,
+  0x12, 0xfa, 0xbd, 0xbe, 0xba, 0xba, 0x20, 0xa0, 0xcc, 0x1c, 0x97, 0x49, 0xad, 0x40, 0xd0, 0x09,
+  0x59, 0x58, 0x56, 0x83, 0x5b, 0x74, 0xe5, 0xcc, 0xa9, 0xbf, 0x8c, 0xea, 0x19, 0xa6, 0xe0, 0x45,
+  0x87, 0x9d, 0x4e, 0x45, 0x84, 0xe7, 0x34, 0x0c, 0xad, 0x6b, 0x86, 0x32, 0xfb, 0xdd, 0x22, 0x86,
+  0xb7, 0x05, 0x1a, 0xee, 0xee, 0x62, 0x19, 0xce, 0xc0, 0x11, 0x42, 0xef, 0x8f, 0xbf, 0x6a, 0xdb,
+  0x56, 0x64, 0x95, 0xdc, 0x01, 0x07, 0x96, 0x0c, 0xf6, 0x25, 0x21, 0x76, 0x23, 0x0b, 0x06, 0x82,
+  0x8c, 0xef, 0xd8, 0x74, 0x5c, 0xd8, 0xc4, 0x71, 0xc6, 0x33, 0x4c, 0x07, 0xe3, 0x62, 0x05, 0xb3,
+  0x7b, 0x1a, 0x80, 0x69, 0xec, 0xe3, 0xa6, 0x4c, 0x50, 0x65, 0xc3, 0x63, 0x3f, 0x90, 0xa1, 0x61,
+  0x3f, 0x7e, 0xe8, 0x08, 0x38, 0x11, 0x82, 0x2a, 0x03, 0x59, 0xc0, 0xa3, 0x35, 0xd0, 0x21, 0x59,
+  0xdc, 0x21, 0xba, 0x76, 0x82, 0x8e, 0x84, 0x27, 0xc4, 0x54, 0xb1, 0x55, 0xa6, 0xc4, 0xe5, 0x29,
+  0x2f, 0xbf, 0x22, 0xda, 0x06, 0x13, 0x15, 0x32, 0xfc, 0xc6, 0xf1, 0xa2, 0xad, 0x3d, 0x14, 0xc0,
+  0xb8, 0x47, 0xfe, 0xb4, 0x68, 0x84, 0x07, 0x4d, 0xb3, 0xce, 0x27, 0x3b, 0x37, 0x37, 0x43, 0xf7,
+  0xb1, 0x8e, 0xef, 0x5e, 0x32, 0x80, 0x6d, 0x97, 0x7a, 0xd7, 0xd1, 0xac, 0x61, 0x10, 0x4f, 0x9e,
+  0x0a, 0x42, 0x5f, 0x1d, 0xda, 0xbe, 0x87, 0x6e, 0xcf, 0x9f, 0x7f, 0x78, 0x61, 0x68, 0xf9, 0x39,
+  0x8e, 0x1a, 0x89, 0xa6, 0x9a, 0x86, 0xca, 0x03, 0x67, 0x4a, 0xea, 0x7c, 0x84, 0x9d, 0x1d, 0x54,
+  0x7c, 0x6d, 0xd4, 0x20, 0x3a, 0x64, 0xa4, 0xf0, 0x0b, 0xee, 0x94, 0x9c, 0x0c, 0x87, 0x30, 0xd2,
+  0x2f, 0x0e, 0xbd, 0x89, 0x89, 0x80, 0x81, 0x04, 0x24, 0x4d, 0xbf, 0x87, 0x33, 0xd4, 0x2c, 0x9c,
+  0x4c, 0xa0, 0x10, 0x94, 0x31, 0x98, 0xf2, 0x28, 0x63, 0xf5, 0x05, 0x0d, 0x18, 0x8b, 0x60, 0x7b,
+  0x69, 0x7b, 0xfe, 0x0d, 0xac, 0x93, 0xdd, 0xdd, 0x5d, 0xd2, 0x69, 0x80, 0x60, 0x84, 0x4c, 0xfc,
+  0xd8, 0x57, 0x3d, 0xbc, 0x04, 0xd2, 0x29, 0xd2, 0x5b, 0xfe, 0xf6, 0x73, 0xe6, 0xdb, 0x0f, 0x78,
+  0x56, 0x96, 0x3c, 0x97, 0x46, 0xc6, 0x27, 0x7d, 0xb2, 0x9d, 0x3e, 0xd1, 0x0f, 0xb0, 0x5c, 0x00,
+  0x45, 0x29, 0xcb, 0x9e, 0x1d, 0x52, 0x17, 0x58, 0x5e, 0x30, 0xb1, 0x58, 0x9d, 0x7c, 0x8c, 0xd5,
+  0x09, 0x83, 0x0d, 0x0b, 0xdb, 0x59, 0x6c, 0x93, 0x6f, 0xff, 0x48, 0x46, 0xba, 0x27, 0x73, 0x45,
+  0xcb, 0x49, 0x27, 0x94, 0xc9, 0xf3, 0x1d, 0xb2, 0x61, 0x1c, 0x25, 0x72, 0xbc, 0x25, 0x55, 0xdf,
+  0xde, 0x3f, 0x80, 0xdd, 0x6c, 0x5f, 0x33, 0xf1, 0x5b, 0x20, 0xd2, 0xff, 0x33, 0x10, 0x49, 0xb7,
+  0x4c, 0xf2, 0x1f, 0xff, 0x41, 0x34, 0xaf, 0x70, 0xfb, 0x34, 0x21, 0x9a, 0x0b, 0x0c, 0x99, 0x20,
+  0x1b, 0xe8, 0x8d, 0xb8, 0x7c, 0x23, 0x83, 0x68, 0x80, 0xa2, 0xf2, 0x17, 0x8c, 0xe1, 0xc0, 0x6b,
+  0x1e, 0xed, 0x62, 0x19, 0x60, 0xae, 0x98, 0x2c, 0x4f, 0x52, 0x4d, 0x66, 0x7c, 0x92, 0x58, 0x68,
+  0x1b, 0xcf, 0xc2, 0x1f, 0xf0, 0xf3, 0xfe, 0x80, 0x5d, 0x06, 0xd9, 0x9f, 0x49, 0x6d, 0x54, 0x03,
+  0x11, 0xac, 0x5d, 0xd6, 0x5e, 0x54, 0x02, 0xc5, 0x4e, 0xf8, 0x6b, 0x80, 0x00, 0x82, 0x1c, 0xce,
+  0xd2, 0x2b, 0x82, 0x94, 0x86, 0x29, 0x4b, 0xb0, 0x12, 0x1f, 0x19, 0x4c, 0x31, 0xfb, 0xda, 0x57,
+  0x90, 0x03, 0x21, 0x62, 0xdd, 0x17, 0xe5, 0x12, 0x92, 0x1a, 0x5e, 0xc5, 0xfa, 0x09, 0x74, 0xc9,
+  0x84, 0xcf, 0x09, 0x2c, 0xf1, 0x59, 0x9b, 0x2d, 0xb9, 0x3a, 0xd7, 0x8d, 0xeb, 0xa4, 0xd7, 0x1e,
+  0x0c, 0x0c, 0x62, 0x90, 0x4f, 0xd2, 0xb6, 0x63, 0x7d, 0x2a, 0x00, 0x96, 0xf5, 0x62, 0x71, 0xf8,
+  0x1c, 0x55, 0x3f, 0x7e, 0xfb, 0x87, 0xe8, 0x7d, 0xff, 0xdd, 0x47, 0x0d, 0x81, 0x08, 0xc5, 0x58,
+  0x8d, 0xaa, 0x84, 0xd1, 0xa8, 0x34, 0xcd, 0x52, 0xc4, 0x59, 0xc5, 0x94, 0xb0, 0x4b, 0xd7, 0x30,
+  0xa3, 0x24, 0x03, 0xde, 0x66, 0xa7, 0x4b, 0xda, 0xe9, 0xe1, 0x12, 0xee, 0x00, 0xec, 0x70, 0x58,
+  0xc0, 0x6d, 0x71, 0xac, 0x96, 0x71, 0x1b, 0x2f, 0xf9, 0xda, 0xdf, 0xdc, 0xaf, 0x95, 0xc1, 0x74,
+  0xc0, 0xb8, 0x08, 0x5e, 0x5f, 0x9d, 0x9e, 0x48, 0x70, 0xfe, 0xf9, 0x5f, 0xff, 0xcd, 0x60, 0xfc,
+  0xf3, 0x3f, 0xff, 0x6f, 0xad, 0xfa, 0x74, 0xb9, 0x65, 0x6b, 0x5c, 0xdc, 0xe0, 0x66, 0xef, 0xb1,
+  0xa3, 0xb3, 0xdc, 0xbb, 0xe1, 0x13, 0xe7, 0xeb, 0xb2, 0x37, 0x18, 0xc0, 0xe8, 0xfc, 0x5e, 0x08,
+  0x96, 0x36, 0x6c, 0x12, 0xcf, 0x17, 0x1e, 0x52, 0xe5, 0xe1, 0x65, 0x1b, 0xdc, 0x28, 0x5a, 0xba,
+  0xc0, 0x32, 0xe7, 0xc0, 0x77, 0xca, 0x0f, 0x0c, 0x65, 0x56, 0x5c, 0x92, 0xc8, 0xc8, 0x89, 0x46,
+  0x5d, 0x03, 0xf2, 0xb9, 0x91, 0x95, 0x79, 0x50, 0xb2, 0x1a, 0x10, 0x4e, 0xdf, 0x7b, 0x15, 0xe0,
+  0x87, 0x17, 0x45, 0x93, 0x49, 0x93, 0x1f, 0x15, 0x51, 0x83, 0xbf, 0xd6, 0xd6, 0xbb, 0x9d, 0xb5,
+  0xea, 0x9c, 0x15, 0xde, 0x8c, 0x89, 0xaa, 0x99, 0xf4, 0x66, 0xb2, 0xde, 0xd8, 0xbf, 0x2f, 0x8a,
+  0x3a, 0x18, 0x96, 0x1a, 0xeb, 0xb8, 0xd2, 0x42, 0x4b, 0x3c, 0x2c, 0x13, 0x86, 0xb9, 0x84, 0x67,
+  0x15, 0x1c, 0xb3, 0x89, 0xcd, 0xa7, 0xc0, 0x52, 0xf6, 0xfc, 0x4c, 0x88, 0x2a, 0x19, 0xd0, 0x2a,
+  0xa8, 0xe6, 0xf3, 0x9c, 0x4f, 0x81, 0x6c, 0xc6, 0x2b, 0x35, 0x61, 0xab, 0x26, 0x44, 0xab, 0xa0,
+  0xab, 0x64, 0x3d, 0x57, 0xc2, 0x77, 0x85, 0xe3, 0xf4, 0xeb, 0xe4, 0x94, 0x5a, 0xe1, 0x12, 0x9c,
+  0x09, 0xf4, 0x24, 0x62, 0x27, 0x22, 0x35, 0xe5, 0xe0, 0x31, 0xe3, 0x72, 0xe2, 0xc0, 0xa8, 0x9e,
+  0x45, 0xea, 0x22, 0x6a, 0x7d, 0x89, 0xd4, 0xc1, 0xca, 0xd8, 0xd1, 0xf8, 0x85, 0xb9, 0x15, 0xfb,
+  0xcc, 0xa0, 0xae, 0x0f, 0x1a, 0x39, 0x7d, 0x20, 0xfa, 0xb5, 0x43, 0x6e, 0x68, 0x6f, 0xd5, 0xc1,
+  0xe9, 0x4f, 0xcc, 0xf6, 0xc2, 0xa6, 0x60, 0x93, 0x77, 0x9b, 0xc4, 0x64, 0x68, 0x6b, 0xfd, 0x40,
+  0x9c, 0x43, 0x3d, 0x06, 0xa3, 0xf8, 0x39, 0x7a, 0xc2, 0x8d, 0xa0, 0x0f, 0x01, 0xbb, 0x28, 0xa1,
+  0x1a, 0xbb, 0x7f, 0x30, 0xf5, 0x5b, 0x9b, 0xe0, 0xca, 0xf1, 0x67, 0xcc, 0xad, 0xe5, 0xfe, 0x90,
+  0xc3, 0xdc, 0x59, 0xdb, 0xbf, 0xf1, 0xf4, 0x84, 0x14, 0xb1, 0x1b, 0x26, 0x68, 0x4d, 0x2e, 0x21,
+  0x61, 0x13, 0xf3, 0x7f, 0x2e, 0x6e, 0x69, 0x6f, 0x02, 0x37, 0x4f, 0x64, 0x94, 0x4a, 0xe1, 0x27,
+  0x7f, 0xff, 0x7d, 0x3c, 0x9d, 0x80, 0x5a, 0xf6, 0x1d, 0x73, 0xf3, 0x98, 0xb0, 0x26, 0x71, 0x88,
+  0xf6, 0xf9, 0xc5, 0xf0, 0x4c, 0x27, 0xa9, 0x32, 0x19, 0x72, 0x5e, 0xdf, 0x7b, 0x8e, 0x4a, 0xbb,
+  0xcd, 0xe5, 0x36, 0xfc, 0x90, 0x67, 0x94, 0x58, 0x1e, 0x9a, 0x1b, 0x38, 0x68, 0x34, 0x99, 0xd5,
+  0x65, 0xdc, 0xdb, 0x13, 0x0c, 0x50, 0xd5, 0x69, 0x10, 0xa0, 0x97, 0x9d, 0x09, 0x4a, 0x0c, 0x83,
+  0x00, 0xc8, 0x85, 0x08, 0xa0, 0x59, 0x26, 0x48, 0xba, 0x5d, 0x6b, 0x12, 0x68, 0xdc, 0x58, 0xe9,
+  0x86, 0x88, 0x38, 0x31, 0xbc, 0x77, 0xb6, 0x77, 0xf2, 0x6e, 0x74, 0x3c, 0x92, 0xdf, 0x5c, 0x31,
+  0xee, 0xc0, 0x00, 0x78, 0x0b, 0x44, 0x98, 0x08, 0x37, 0x10, 0x48, 0xd4, 0x0c, 0xfa, 0xe8, 0x52,
+  0x03, 0x87, 0x98, 0xc5, 0xdb, 0x26, 0x7b, 0xe0, 0x38, 0x63, 0xa8, 0x10, 0x83, 0xb8, 0x88, 0x5b,
+  0x28, 0x03, 0xdb, 0x22, 0x63, 0x64, 0xbb, 0x4b, 0x3f, 0x03, 0x01, 0xc0, 0x5c, 0x48, 0x9d, 0x7c,
+  0xcc, 0xd7, 0xdd, 0xc9, 0xc1, 0xa8, 0xdf, 0x4e, 0x47, 0xa4, 0xee, 0x60, 0xe2, 0x1b, 0x43, 0x1d,
+  0xd8, 0x6e, 0x4c, 0xad, 0xa8, 0xd1, 0x94, 0xc1, 0x21, 0x2c, 0x0b, 0xf4, 0x3e, 0x56, 0xb1, 0xcd,
+  0x7c, 0x57, 0xb4, 0x0b, 0xd9, 0x52, 0x44, 0x02, 0xc6, 0x61, 0x84, 0x39, 0x5f, 0xb0, 0xf1, 0xfa,
+  0xf4, 0xd5, 0xa5, 0x09, 0xc0, 0x42, 0x9f, 0xb8, 0x2c, 0x41, 0x84, 0x50, 0x39, 0x0c, 0x11, 0x39,
+  0x00, 0xb3, 0x86, 0xa2, 0x51, 0xdf, 0xce, 0xc5, 0x02, 0x39, 0xb6, 0xfb, 0x7b, 0x67, 0x87, 0xbf,
+  0x0d, 0x0f, 0x5f, 0x0d, 0x47, 0x18, 0x59, 0xed, 0xc1, 0x9a, 0xdb, 0xc4, 0x0b, 0xf0, 0x07, 0xf0,
+  0x57, 0xbf, 0xc3, 0xbe, 0xe1, 0xd7, 0x1e, 0xfe, 0xdd, 0xdb, 0xc0, 0xbf, 0x07, 0x9d, 0xf8, 0x49,
+  0xe7, 0x03, 0x33, 0x54, 0x5e, 0x7f, 0xd1, 0x02, 0x4e, 0xc8, 0xb0, 0x93, 0xb9, 0x28, 0x1e, 0xc3,
+  0x07, 0x2c, 0x07, 0xcf, 0x74, 0xdb, 0xad, 0x1a, 0x80, 0x63, 0x0d, 0x62, 0x16, 0x14, 0xbd, 0x3c,
+  0x14, 0x31, 0x0b, 0xb5, 0x41, 0xe2, 0xce, 0x9a, 0x5f, 0x63, 0x1c, 0x49, 0x0f, 0x7e, 0x01, 0xe2,
+  0x68, 0x7e, 0xcb, 0x3a, 0x8f, 0xe8, 0xef, 0x6a, 0xee, 0x3d, 0xeb, 0xab, 0xe7, 0x5e, 0x22, 0xb7,
+  0x4e, 0x60, 0x75, 0x7a, 0x93, 0x3b, 0xf6, 0x7a, 0xb3, 0xc3, 0x48, 0xf7, 0xbf, 0x9c, 0x08, 0xb3,
+  0x48, 0x5c, 0xff, 0x70, 0x49, 0xc0, 0x9f, 0x50, 0xb7, 0x84, 0x37, 0xc6, 0x2b, 0x52, 0x33, 0x80,
+  0x22, 0xc0, 0x0c, 0x6f, 0x96, 0x16, 0xd9, 0x7d, 0x86, 0x20, 0xd3, 0x4d, 0x28, 0xe3, 0x89, 0x38,
+  0xce, 0xac, 0x10, 0x24, 0x2b, 0x6e, 0x8b, 0x21, 0x22, 0xed, 0xb2, 0xb9, 0x12, 0x0d, 0xa0, 0x31,
+  0xec, 0x07, 0x58, 0x00, 0x0d, 0x42, 0x33, 0x8d, 0x12, 0xa5, 0x06, 0x20, 0x59, 0x1d, 0xef, 0x8d,
+  0x13, 0xcd, 0xfc, 0x25, 0x28, 0xb2, 0x28, 0xc4, 0xec, 0x07, 0x1a, 0x2a, 0xbe, 0x46, 0x9d, 0xc1,
+  0xa8, 0x31, 0x44, 0x65, 0x6b, 0x08, 0x68, 0xb4, 0x0c, 0x3c, 0xa5, 0x40, 0x01, 0x14, 0x17, 0x2c,
+  0xcc, 0x09, 0xad, 0xaf, 0xff, 0x7b, 0xfb, 0xfd, 0xff, 0x69, 0x7f, 0xf8, 0xe1, 0xdb, 0xf5, 0x26,
+  0xa9, 0xd5, 0x1a, 0x4c, 0x8b, 0xc9, 0x73, 0x2d, 0xd4, 0xcd, 0x92, 0x42, 0x8d, 0x96, 0xb1, 0x73,
+  0xab, 0x51, 0x9b, 0xb2, 0xdc, 0x35, 0x04, 0x4a, 0xb9, 0xeb, 0xb6, 0x72, 0x92, 0x09, 0x9a, 0xb1,
+  0x0e, 0xfb, 0x32, 0xa8, 0xef, 0xf6, 0x9e, 0xfc, 0x0a, 0xfc, 0x78, 0xf1, 0x98, 0xdf, 0x02, 0x2d,
+  0xbf, 0x6c, 0xe4, 0x83, 0x28, 0x71, 0x69, 0xcf, 0x12, 0xbc, 0x25, 0x00, 0x2a, 0x8f, 0xd1, 0x9e,
+  0x60, 0xfe, 0x9c, 0x9e, 0xe2, 0x9d, 0x42, 0xa2, 0x4c, 0x65, 0xc4, 0xda, 0xd5, 0xa5, 0x3a, 0x95,
+  0x1c, 0x38, 0x69, 0x71, 0x68, 0x40, 0xed, 0x89, 0xb7, 0x75, 0x43, 0xaf, 0xf6, 0x74, 0x1a, 0x8d,
+  0x9c, 0x2f, 0x88, 0x48, 0xb7, 0xd3, 0xdb, 0x30, 0x34, 0x0a, 0xe7, 0xbe, 0x0f, 0x6a, 0x91, 0xaf,
+  0x84, 0x03, 0xc4, 0xdf, 0x62, 0x66, 0x48, 0xa7, 0x3d, 0xd0, 0xf7, 0x38, 0xd4, 0x06, 0x10, 0xd3,
+  0x41, 0xe3, 0x54, 0xc8, 0xbe, 0xe3, 0xb1, 0xec, 0x55, 0x43, 0x43, 0xf7, 0x78, 0xc9, 0x6a, 0x66,
+  0xc5, 0x83, 0x53, 0xdd, 0xb6, 0xba, 0x9b, 0x23, 0xb1, 0xda, 0x22, 0x1a, 0x9c, 0x8c, 0x07, 0x1e,
+  0x94, 0x1c, 0x80, 0x16, 0x34, 0xb1, 0x09, 0xac, 0x50, 0x04, 0x44, 0x6d, 0xd8, 0xdc, 0x0a, 0xe1,
+  0x24, 0xe8, 0xa4, 0x90, 0x00, 0x0e, 0xf4, 0x9a, 0x51, 0x2b, 0xb0, 0x89, 0x80, 0x62, 0x98, 0x42,
+  0x16, 0x4c, 0x3c, 0x11, 0x9b, 0x86, 0x91, 0xe3, 0xb1, 0x64, 0x40, 0x6e, 0x12, 0x45, 0x41, 0xb8,
+  0x62, 0x69, 0xf7, 0x6c, 0xd6, 0xeb, 0x28, 0x80, 0x15, 0xa2, 0x95, 0xf8, 0x6f, 0x84, 0xa5, 0x00,
+  0xf2, 0xaa, 0x5a, 0x0a, 0xdf, 0x68, 0x2c, 0x05, 0xdd, 0xa2, 0x48, 0x2d, 0x0e, 0x61, 0x29, 0x51,
+  0x7b, 0x6f, 0x8e, 0x4c, 0x24, 0xbb, 0x64, 0x73, 0x23, 0xe9, 0x83, 0x14, 0xc2, 0xb4, 0x35, 0x0b,
+  0xdf, 0x53, 0x10, 0x1e, 0x1b, 0x43, 0x9c, 0x9f, 0x60, 0xcb, 0x72, 0x40, 0x7e, 0x50, 0xa9, 0xf9,
+  0x53, 0x02, 0x52, 0xb0, 0xa4, 0x20, 0x57, 0xe6, 0x5b, 0xa5, 0x12, 0x99, 0x81, 0x5d, 0x6b, 0xff,
+  0x2e, 0xa2, 0x49, 0x16, 0x0d, 0x45, 0xac, 0x2e, 0xcb, 0x9b, 0x76, 0x99, 0x8d, 0x1d, 0xef, 0xf5,
+  0x97, 0xbc, 0x10, 0x85, 0x80, 0x96, 0x4b, 0x2f, 0x71, 0xd2, 0xeb, 0xca, 0x4a, 0xd0, 0x2e, 0x56,
+  0x6e, 0x75, 0xab, 0x26, 0xe5, 0xf7, 0xa4, 0x73, 0x7b, 0x04, 0xff, 0xa5, 0xb3, 0xe5, 0x86, 0xc5,
+  0x14, 0x59, 0x10, 0xe2, 0xbd, 0xff, 0x89, 0x45, 0x31, 0xc1, 0x22, 0x09, 0x0d, 0x6c, 0xd6, 0x54,
+  0x5d, 0x2b, 0xdd, 0x3e, 0xf7, 0xfb, 0xb9, 0xf5, 0x15, 0xd2, 0xdf, 0xc1, 0x0a, 0x74, 0xad, 0xeb,
+  0x90, 0xd4, 0x3b, 0x8d, 0x26, 0xe3, 0x35, 0x53, 0x88, 0x4d, 0x61, 0x85, 0x84, 0xd9, 0xab, 0x04,
+  0x11, 0xe6, 0xfb, 0xce, 0x07, 0xc2, 0x1d, 0x15, 0x69, 0x07, 0x7e, 0xa1, 0x69, 0xd7, 0xfd, 0x10,
+  0x13, 0x88, 0xef, 0x64, 0xf5, 0xe4, 0x33, 0x73, 0x85, 0xbf, 0xc7, 0xd8, 0x83, 0xae, 0x5f, 0x1f,
+  0xfb, 0x31, 0xd2, 0x80, 0x61, 0xbd, 0xa5, 0x6b, 0xb1, 0x91, 0xb4, 0xd0, 0x01, 0x01, 0x7b, 0xaf,
+  0x8e, 0x9b, 0x18, 0xb3, 0xa2, 0x70, 0x8f, 0xe4, 0x9f, 0x5e, 0x02, 0x2c, 0xf6, 0xe9, 0xf9, 0x73,
+  0x73, 0xae, 0x60, 0xea, 0x04, 0x61, 0x12, 0xf8, 0x9a, 0x5b, 0xb7, 0x68, 0xf1, 0xb3, 0xcf, 0x53,
+  0xd7, 0xf7, 0x83, 0x7a, 0xde, 0x98, 0x79, 0x8f, 0xf0, 0x3e, 0x00, 0xb7, 0x99, 0x3c, 0x34, 0x1a,
+  0xa6, 0xc4, 0x82, 0x6b, 0x49, 0x50, 0x1d, 0x2f, 0x23, 0x5f, 0x22, 0x7f, 0xd1, 0xd4, 0x3a, 0x6c,
+  0xea, 0x7f, 0x09, 0x66, 0x1c, 0xd5, 0xe7, 0xa4, 0x02, 0x86, 0xd8, 0x4a, 0xc2, 0x52, 0x83, 0x26,
+  0x33, 0x49, 0xa8, 0xf5, 0x49, 0xcd, 0xb7, 0x64, 0x49, 0xea, 0xb0, 0xc2, 0x42, 0x1c, 0xf9, 0x05,
+  0xfb, 0xf2, 0x92, 0x4d, 0x8d, 0x7d, 0x46, 0xb2, 0x0a, 0x10, 0x09, 0x8e, 0xf8, 0xbd, 0x99, 0xd1,
+  0xde, 0xef, 0xa1, 0xe5, 0x07, 0x0d, 0x02, 0x9c, 0xb1, 0x03, 0xc0, 0x94, 0x93, 0x74, 0x87, 0xc1,
+  0x2a, 0xba, 0x24, 0x4e, 0xf6, 0x2d, 0x58, 0xef, 0x52, 0xcf, 0xea, 0xdc, 0xa3, 0xad, 0x1b, 0xd0,
+  0xfd, 0x79, 0x03, 0x17, 0x16, 0xd7, 0x32, 0x14, 0xdf, 0x98, 0xf1, 0x84, 0x2a, 0x04, 0xad, 0x90,
+  0x7f, 0xc8, 0x86, 0x93, 0xaa, 0x19, 0x55, 0x8d, 0xaa, 0xd3, 0x8d, 0x92, 0x96, 0xd7, 0xea, 0xbd,
+  0x58, 0x15, 0xc0, 0xbf, 0x76, 0x28, 0x0b, 0x09, 0xec, 0x82, 0x4d, 0x52, 0x97, 0x0d, 0xbe, 0x75,
+  0xd2, 0x03, 0x02, 0x65, 0xac, 0xbc, 0x06, 0x3c, 0xec, 0xaa, 0x69, 0x49, 0x69, 0x9b, 0x60, 0xbb,
+  0x08, 0x6e, 0xb0, 0xe8, 0xc7, 0x5e, 0x59, 0x01, 0x28, 0xbc, 0x3d, 0x96, 0xe0, 0xac, 0x8b, 0x31,
+  0x9b, 0xb9, 0xad, 0x90, 0x87, 0xae, 0xae, 0x98, 0x16, 0x00, 0x1c, 0x4a, 0xc9, 0x7a, 0x25, 0xdb,
+  0x83, 0x4c, 0x27, 0x71, 0x57, 0x28, 0xa0, 0x2d, 0xc1, 0x79, 0x7b, 0x9b, 0x44, 0xd4, 0x75, 0xd1,
+  0x4b, 0xbd, 0x61, 0x19, 0xc6, 0xc4, 0xf0, 0x73, 0x32, 0x9e, 0x0f, 0xbc, 0xe4, 0xa9, 0x47, 0x2c,
+  0x8d, 0xa1, 0x78, 0xb7, 0x23, 0x6e, 0x84, 0x21, 0xf4, 0x6b, 0x32, 0x87, 0x03, 0xfa, 0xc7, 0x0e,
+  0x16, 0xf4, 0x9f, 0xf9, 0x37, 0xdc, 0x80, 0x9d, 0x62, 0xa5, 0x84, 0x7e, 0xe3, 0x8a, 0x2d, 0xc5,
+  0x0b, 0x1d, 0x7b, 0x44, 0xb4, 0x5b, 0x5c, 0x67, 0x9b, 0x0d, 0x77, 0x4b, 0x86, 0x91, 0x4c, 0x11,
+  0xf2, 0x83, 0x8e, 0xda, 0xf1, 0x59, 0x02, 0x6e, 0x58, 0x24, 0xd2, 0xdf, 0x69, 0x2a, 0x10, 0xf3,
+  0x2c, 0xe1, 0x31, 0x1b, 0x0e, 0x14, 0xf6, 0xb1, 0x1c, 0xb3, 0xf3, 0x2b, 0x55, 0xf6, 0xe4, 0x51,
+  0x01, 0x67, 0xaa, 0x10, 0xcc, 0x0a, 0xe4, 0x7d, 0x32, 0x45, 0x0c, 0x55, 0xf4, 0x36, 0x9a, 0x2c,
+  0x7d, 0x9a, 0x3e, 0xe9, 0x6e, 0x0a, 0x6d, 0x9c, 0x7f, 0xb1, 0x95, 0x3c, 0x4f, 0x1e, 0xf3, 0xef,
+  0x66, 0x5d, 0xc5, 0x89, 0xc0, 0x3a, 0x37, 0xc5, 0x17, 0xd6, 0xe5, 0x83, 0xb9, 0xcf, 0xc7, 0xf5,
+  0xd8, 0x04, 0xff, 0x19, 0xb9, 0xbb, 0xf3, 0xed, 0x1f, 0xf1, 0x68, 0xf7, 0xdf, 0x3b, 0x1e, 0x7c,
+  0x65, 0x60, 0xee, 0x3f, 0x56, 0xb4, 0x57, 0x26, 0x58, 0x10, 0xcb, 0x16, 0xa5, 0x58, 0x24, 0x0a,
+  0xdf, 0x79, 0x00, 0xa1, 0xc6, 0xfd, 0x9e, 0x5a, 0x43, 0x41, 0xac, 0x0d, 0xe2, 0xe5, 0xd5, 0x03,
+  0x1a, 0x2e, 0x7c, 0x2c, 0xde, 0xdc, 0xd9, 0x25, 0xf1, 0xe7, 0xf6, 0x3f, 0x40, 0x6a, 0xeb, 0x0d,
+  0x53, 0x17, 0x3c, 0x0a, 0xca, 0xea, 0x13, 0x14, 0x4f, 0x0c, 0xdf, 0xb4, 0x85, 0x76, 0x79, 0xa1,
+  0x33, 0xc5, 0xc8, 0xbd, 0x06, 0x68, 0x59, 0x58, 0x03, 0xad, 0x2c, 0x0c, 0x6b, 0xf0, 0x03, 0x88,
+  0x02, 0xbc, 0x26, 0xb8, 0x51, 0x4a, 0x2e, 0xa3, 0x43, 0x15, 0x93, 0x2a, 0xe6, 0xd0, 0xd7, 0xa1,
+  0x56, 0xce, 0xdd, 0x64, 0xc4, 0x42, 0x3f, 0xb1, 0x88, 0x2a, 0xa2, 0x12, 0x44, 0xef, 0xaa, 0xde,
+  0x57, 0xb5, 0x6d, 0x23, 0x2b, 0x88, 0xf4, 0x9e, 0x9c, 0xec, 0xe4, 0xe5, 0x56, 0xbb, 0x2a, 0x60,
+  0x66, 0xf7, 0x0e, 0x2c, 0xe1, 0x70, 0x89, 0x66, 0x73, 0x0e, 0x86, 0x0b, 0x8a, 0xed, 0x18, 0xcb,
+  0xeb, 0x40, 0x03, 0xd4, 0xd3, 0x58, 0x41, 0x61, 0xb3, 0x24, 0x66, 0xa0, 0x1b, 0x4f, 0x1f, 0x4c,
+  0x48, 0x5e, 0x0b, 0x55, 0xb6, 0x60, 0xd2, 0xc6, 0xe9, 0x6f, 0xaa, 0xa5, 0xc1, 0x5d, 0x2b, 0xe3,
+  0x64, 0x9b, 0x62, 0xd0, 0xaa, 0x82, 0x2d, 0x0c, 0x72, 0x67, 0x13, 0xc4, 0x7a, 0x90, 0x99, 0xa9,
+  0x00, 0x0b, 0x92, 0xb9, 0x67, 0xbd, 0x90, 0x66, 0x2e, 0xfa, 0xd3, 0x28, 0x8d, 0x56, 0xe7, 0x7f,
+  0x70, 0x4f, 0x0a, 0xbf, 0xc8, 0xc3, 0x14, 0xd1, 0x64, 0xd5, 0x70, 0xa8, 0xb1, 0xc6, 0x49, 0x29,
+  0x24, 0x2a, 0x16, 0x51, 0xdf, 0x10, 0x6b, 0xc8, 0xf0, 0xd5, 0x5a, 0x86, 0x7f, 0xa9, 0x90, 0x99,
+  0xe3, 0x59, 0x9a, 0xc9, 0xc9, 0x98, 0x5b, 0xb6, 0x3d, 0xc4, 0x2a, 0xa8, 0x13, 0xb1, 0xe5, 0xd7,
+  0x6b, 0x40, 0x36, 0x6a, 0x83, 0x12, 0xd3, 0xf1, 0x42, 0x95, 0x23, 0x7e, 0xfb, 0xd0, 0x69, 0x9a,
+  0xe4, 0xcf, 0xf8, 0xb5, 0x86, 0xb3, 0x37, 0xac, 0x56, 0x4c, 0x0a, 0x5d, 0x31, 0x5b, 0xc2, 0x41,
+  0x62, 0xe3, 0xf3, 0x24, 0x36, 0x95, 0x98, 0x21, 0x21, 0xa5, 0x9f, 0xc2, 0x8a, 0xe8, 0x63, 0xdb,
+  0xca, 0xf8, 0xa3, 0x34, 0xe5, 0xd6, 0x5a, 0xd1, 0xaa, 0xd2, 0xce, 0x27, 0x57, 0x39, 0xf8, 0xa2,
+  0xd0, 0x48, 0xab, 0x81, 0x75, 0x06, 0x0a, 0xcc, 0x5e, 0xba, 0x94, 0x04, 0x4b, 0x2f, 0xe4, 0x7e,
+  0x24, 0xe5, 0x81, 0xe9, 0x9a, 0x70, 0x27, 0x45, 0xad, 0x1c, 0x98, 0x5b, 0x60, 0x2c, 0x86, 0x64,
+  0x74, 0x76, 0x75, 0xf1, 0x2c, 0xbb, 0x23, 0xf0, 0x3d, 0xfb, 0x67, 0xba, 0xf0, 0x27, 0x33, 0xd8,
+  0xa1, 0x25, 0x07, 0x04, 0x8c, 0xfc, 0xd8, 0x8b, 0x15, 0x96, 0xe9, 0xfd, 0xf7, 0xd1, 0x17, 0x68,
+  0xd3, 0x12, 0x79, 0x1a, 0x98, 0x24, 0x3a, 0xdd, 0x38, 0xc5, 0x2f, 0x30, 0xe6, 0xf9, 0x74, 0x1a,
+  0x22, 0xda, 0xb0, 0xbf, 0x3f, 0x5b, 0x69, 0xf3, 0x0b, 0xf1, 0xe8, 0x8c, 0x1c, 0x8e, 0x64, 0xa8,
+  0x6b, 0x76, 0x3f, 0x99, 0x0c, 0xc7, 0x1e, 0x18, 0x16, 0xac, 0x6e, 0x3f, 0x29, 0xc3, 0x66, 0xb7,
+  0xa5, 0x67, 0x4e, 0x18, 0x89, 0x37, 0x6d, 0x70, 0x7b, 0x86, 0x16, 0x6e, 0x35, 0xfc, 0x41, 0x93,
+  0xb0, 0xdf, 0x94, 0xd0, 0x70, 0x55, 0x3e, 0x92, 0x94, 0x3b, 0x9a, 0xc7, 0x03, 0x4b, 0x22, 0xe8,
+  0x56, 0xaf, 0xf1, 0x8b, 0x2d, 0xf2, 0x15, 0x91, 0x49, 0xcf, 0x36, 0xbb, 0x33, 0x40, 0x6c, 0x65,
+  0xb5, 0xf4, 0x82, 0xef, 0x9a, 0xa9, 0x7d, 0x36, 0x7d, 0xc7, 0x9f, 0x9b, 0xda, 0x62, 0x55, 0x1b,
+  0x10, 0xad, 0xcd, 0x4e, 0x21, 0xb3, 0xa9, 0x98, 0x5a, 0x62, 0xbd, 0xa5, 0x33, 0xf9, 0x94, 0xd4,
+  0x5b, 0x42, 0x2f, 0x51, 0x39, 0xc0, 0x29, 0xa0, 0xeb, 0xc7, 0x8e, 0x2c, 0xb7, 0xf1, 0xa7, 0xff,
+  0xc0, 0x46, 0x9d, 0x39, 0xae, 0x5d, 0x4f, 0xe0, 0x55, 0x58, 0x90, 0x12, 0x5f, 0x2c, 0xf5, 0xc8,
+  0x06, 0x63, 0x51, 0xf6, 0xb8, 0x86, 0x72, 0x50, 0xe3, 0x5f, 0x9f, 0x5b, 0xe0, 0xfa, 0x89, 0x80,
+  0x3e, 0x96, 0xc0, 0x47, 0xdc, 0xf7, 0xd9, 0xec, 0x3e, 0x8c, 0x87, 0x0c, 0x58, 0x5e, 0xc5, 0xeb,
+  0x4e, 0xc8, 0x3f, 0x05, 0x4b, 0x6f, 0x32, 0xa7, 0x34, 0x18, 0x37, 0xb3, 0x27, 0x34, 0xe4, 0xb3,
+  0x19, 0x7f, 0x39, 0x23, 0xf3, 0x3f, 0x11, 0xfd, 0xf5, 0xd8, 0xb9, 0xa5, 0xb0, 0x73, 0xeb, 0xe1,
+  0xec, 0xdc, 0xca, 0xb3, 0x33, 0x7f, 0x3b, 0xc1, 0x53, 0x70, 0x92, 0x66, 0x4e, 0xb0, 0x70, 0x4e,
+  0x66, 0x4f, 0xaf, 0xc8, 0xe7, 0x56, 0xfe, 0xbf, 0x58, 0x93, 0x5b, 0x03, 0x85, 0x89, 0x9b, 0x0f,
+  0x67, 0x62, 0xbe, 0xb6, 0x2e, 0x7f, 0x29, 0xc4, 0x93, 0x2c, 0x47, 0x27, 0x9a, 0x89, 0x48, 0x27,
+  0x87, 0x40, 0xf8, 0x0f, 0x2b, 0x24, 0xcd, 0xf5, 0x77, 0x4b, 0xd4, 0x6b, 0xd2, 0x4f, 0x4e, 0xbc,
+  0x47, 0x5a, 0xb4, 0xf0, 0xce, 0x9b, 0xce, 0xda, 0x87, 0x5a, 0x83, 0x93, 0x1d, 0x8d, 0x20, 0xb4,
+  0x88, 0xea, 0x35, 0x0e, 0xd0, 0x74, 0xf4, 0x99, 0x17, 0xcf, 0x89, 0x5f, 0x85, 0x89, 0x2d, 0x5d,
+  0xc0, 0x2d, 0xba, 0xd3, 0xa5, 0xfb, 0xd0, 0xbe, 0x3b, 0x48, 0x2f, 0x92, 0x39, 0x40, 0x12, 0xc6,
+  0x45, 0xf5, 0xda, 0x80, 0xce, 0x43, 0xaf, 0xa5, 0x91, 0xa3, 0x71, 0x7c, 0xca, 0xc6, 0x7b, 0x36,
+  0x92, 0x4b, 0x36, 0xe2, 0x96, 0x7a, 0x38, 0x01, 0x2f, 0x73, 0xe3, 0x18, 0xb1, 0x54, 0x03, 0x06,
+  0x78, 0xc0, 0x6a, 0x81, 0x49, 0x00, 0xcc, 0x4b, 0x64, 0x7d, 0xae, 0xa3, 0x06, 0x0a, 0x1e, 0xd2,
+  0xe7, 0x27, 0x05, 0x26, 0xac, 0xdb, 0xaf, 0x18, 0x29, 0x82, 0xae, 0x6d, 0xfc, 0x49, 0x25, 0xdd,
+  0xb0, 0x77, 0xb9, 0x0e, 0xef, 0xe2, 0x0e, 0xe0, 0x4b, 0x94, 0x8e, 0xc6, 0x7f, 0xfe, 0xe7, 0x57,
+  0xac, 0x04, 0xc7, 0x2e, 0xec, 0x77, 0x6a, 0x30, 0x18, 0xf5, 0xc2, 0xd8, 0xf6, 0x5d, 0xdc, 0x96,
+  0xff, 0xee, 0x8b, 0xa9, 0xb1, 0x4d, 0xdd, 0xc8, 0x42, 0xb8, 0xb7, 0x78, 0x5a, 0x81, 0x8f, 0x62,
+  0x6c, 0x87, 0x30, 0xef, 0x92, 0x76, 0xef, 0xb4, 0xed, 0x1c, 0xcc, 0x17, 0xb2, 0x64, 0x27, 0xb3,
+  0x3f, 0xc3, 0xdf, 0x83, 0xa8, 0x2e, 0x06, 0xf9, 0x21, 0x1e, 0xed, 0x79, 0x0c, 0x4e, 0x3c, 0x79,
+  0xa7, 0xe7, 0x13, 0xfb, 0xa9, 0x27, 0x65, 0xca, 0x30, 0x7e, 0xfe, 0xd7, 0xe7, 0x15, 0x6b, 0x3e,
+  0xc1, 0x62, 0x57, 0x40, 0xd1, 0x47, 0x79, 0x73, 0xb1, 0x05, 0x2e, 0x34, 0xa2, 0xaa, 0x14, 0xd9,
+  0xc8, 0xc8, 0xf2, 0x9c, 0xd4, 0x16, 0xb7, 0xf9, 0xa3, 0x38, 0xd9, 0xb6, 0xc0, 0x41, 0x46, 0x19,
+  0x5d, 0x53, 0xcd, 0xc4, 0x2c, 0xef, 0xda, 0x4d, 0x08, 0x04, 0x2b, 0xd6, 0xeb, 0x71, 0x0a, 0xbd,
+  0x6b, 0x0a, 0x02, 0x35, 0x30, 0xf8, 0xb8, 0xd5, 0x81, 0xd9, 0xb2, 0x26, 0x17, 0xc7, 0x3a, 0xf2,
+  0x78, 0x98, 0x9d, 0x42, 0xd5, 0x61, 0xef, 0x09, 0x78, 0x75, 0x0e, 0xf8, 0x39, 0xe9, 0x83, 0x15,
+  0x41, 0xbe, 0xc3, 0x7f, 0x74, 0x1d, 0x67, 0xac, 0x20, 0x2d, 0xd7, 0xbd, 0x14, 0xe9, 0x19, 0xbd,
+  0x8d, 0xcb, 0x6b, 0x67, 0xa1, 0x7b, 0xe5, 0xbf, 0xa6, 0xb7, 0x75, 0x80, 0xd4, 0x44, 0x77, 0x02,
+  0x2b, 0x43, 0x94, 0xa8, 0x68, 0xf4, 0xbf, 0x97, 0xb0, 0xc2, 0x58, 0x9f, 0x7a, 0xdc, 0xb9, 0x34,
+  0x6c, 0xfd, 0x06, 0x5c, 0x1c, 0xd0, 0x38, 0x89, 0xa6, 0x09, 0x35, 0xba, 0x27, 0x19, 0xbd, 0x49,
+  0xc2, 0x26, 0x51, 0x8a, 0xa4, 0x40, 0x48, 0x76, 0xd4, 0xa9, 0x87, 0xf8, 0xb4, 0x9b, 0xff, 0x29,
+  0x38, 0x57, 0xfb, 0x54, 0x39, 0xf3, 0x12, 0x34, 0xc9, 0x75, 0x93, 0x8c, 0x4b, 0x84, 0x2e, 0x64,
+  0x01, 0x87, 0x8e, 0x2e, 0x8a, 0x82, 0x54, 0xc3, 0x12, 0xfe, 0x31, 0xfc, 0xef, 0x56, 0xac, 0xa8,
+  0x4a, 0x98, 0xd5, 0x0b, 0xae, 0xb1, 0x5f, 0x7d, 0xd1, 0x24, 0xbf, 0x37, 0x49, 0x64, 0x08, 0x86,
+  0x24, 0xc5, 0xe5, 0xe4, 0x25, 0xe2, 0x10, 0x19, 0xea, 0xcf, 0xd3, 0x66, 0xbb, 0x98, 0xef, 0x8b,
+  0x48, 0xab, 0xa4, 0xd9, 0x4b, 0xd2, 0x5d, 0xdf, 0x8c, 0x97, 0x0f, 0x59, 0x80, 0x74, 0xd5, 0x7f,
+  0x87, 0x25, 0xb8, 0x40, 0x19, 0xdd, 0x84, 0xff, 0xa3, 0xb2, 0xce, 0xbd, 0xa4, 0xf3, 0xef, 0xc5,
+  0x4d, 0x7b, 0xeb, 0x7d, 0xc3, 0x38, 0x75, 0x78, 0x05, 0x9f, 0x23, 0x36, 0xa6, 0xa1, 0x3c, 0x55,
+  0xf4, 0xd3, 0xc4, 0x9c, 0x2a, 0x9c, 0x17, 0xe2, 0xb4, 0xc6, 0x7c, 0xa8, 0x8b, 0xe4, 0x6b, 0x0f,
+  0xc8, 0xcf, 0xf0, 0x09, 0x06, 0xee, 0x02, 0x1e, 0xa0, 0x3c, 0xb6, 0xe1, 0x1b, 0x7c, 0x00, 0x1c,
+  0xf0, 0x69, 0x68, 0xca, 0x28, 0xa2, 0x16, 0xe8, 0x41, 0x03, 0x17, 0x1a, 0x6a, 0x26, 0xcb, 0xd6,
+  0x0e, 0xe7, 0xa7, 0x60, 0xe6, 0x0c, 0x93, 0x80, 0xeb, 0x7d, 0xdd, 0x0f, 0x9b, 0xa9, 0x6d, 0x35,
+  0xad, 0xc6, 0x1a, 0x88, 0x2d, 0x0d, 0xc4, 0xfb, 0xb2, 0xd5, 0x1d, 0xe1, 0x8a, 0x62, 0xea, 0xce,
+  0x78, 0xa4, 0x90, 0xa9, 0x80, 0x6c, 0x3e, 0xe6, 0x16, 0xe6, 0xda, 0x1b, 0x0c, 0x1a, 0xa0, 0x00,
+  0x47, 0x51, 0x80, 0x51, 0xb5, 0xee, 0xa6, 0x06, 0x4b, 0xc1, 0x1b, 0xe8, 0x2e, 0xd2, 0xaa, 0xbc,
+  0xbc, 0x1f, 0x2b, 0xeb, 0x3b, 0x35, 0xa0, 0x00, 0xc2, 0xdd, 0xc6, 0xbf, 0x0b, 0x4f, 0xf1, 0xe9,
+  0x6a, 0x8a, 0x3e, 0xfe, 0xed, 0xdb, 0x3f, 0x18, 0xea, 0xf5, 0xa0, 0x71, 0x1f, 0x7f, 0xbc, 0x4e,
+  0x3f, 0x8e, 0x1b, 0xf7, 0x1f, 0x2b, 0x97, 0x0f, 0x65, 0xf5, 0x95, 0xde, 0x8c, 0x49, 0x0e, 0x4f,
+  0x58, 0x41, 0x48, 0x8f, 0xc1, 0xf4, 0xc5, 0x49, 0x85, 0xcb, 0x71, 0x28, 0xa6, 0xdf, 0x68, 0x12,
+  0x85, 0x04, 0xf9, 0x04, 0x11, 0x3b, 0x9c, 0xd4, 0x24, 0xef, 0xc5, 0x51, 0x87, 0x5c, 0xae, 0x27,
+  0x79, 0x98, 0xe6, 0x79, 0xf8, 0xa3, 0xb2, 0x8c, 0x4d, 0x6d, 0x9d, 0x19, 0x3f, 0x3f, 0x03, 0x46,
+  0x3b, 0x82, 0xaa, 0x19, 0xcc, 0x2a, 0x86, 0x36, 0x95, 0x73, 0x09, 0x8e, 0x9d, 0x27, 0x05, 0xe8,
+  0xe9, 0x4b, 0x3a, 0xf7, 0x3f, 0x53, 0x61, 0xa2, 0xf2, 0x4b, 0x15, 0xc5, 0x29, 0x22, 0x37, 0x8e,
+  0x10, 0x10, 0x71, 0xbd, 0x6c, 0xf6, 0x37, 0xb9, 0x0a, 0x2e, 0x48, 0x4b, 0xed, 0xd8, 0x26, 0x69,
+  0x2b, 0xfe, 0x5e, 0x23, 0xf1, 0x5b, 0xc6, 0x7a, 0x19, 0x1d, 0x4b, 0xe6, 0x6e, 0xc0, 0xd0, 0xd3,
+  0x59, 0xbc, 0xba, 0xb8, 0x73, 0x7e, 0x72, 0x7b, 0xb6, 0x9d, 0x9d, 0x99, 0x48, 0x4b, 0x73, 0x6c,
+  0x6a, 0xa1, 0x98, 0x59, 0x55, 0x5f, 0x29, 0x6b, 0xa3, 0x7e, 0x4c, 0x8d, 0xf4, 0x6f, 0xff, 0x70,
+  0xec, 0xfb, 0xb5, 0x0f, 0xf9, 0x03, 0x73, 0xa8, 0x0f, 0x53, 0x27, 0x42, 0x33, 0xd3, 0x9c, 0x5f,
+  0x55, 0x64, 0xe0, 0x97, 0x56, 0xd0, 0xca, 0x0b, 0xc0, 0xc8, 0x70, 0x9d, 0x4c, 0x14, 0xcb, 0x38,
+  0xaf, 0xed, 0x07, 0x21, 0x77, 0xec, 0x0f, 0x4d, 0x10, 0x4d, 0x8e, 0xf2, 0xcf, 0x30, 0x6b, 0x14,
+  0xcd, 0x4c, 0xf7, 0x22, 0xa4, 0xf8, 0xb1, 0x9c, 0xa1, 0x74, 0x6f, 0x61, 0x1d, 0x0f, 0x3f, 0xeb,
+  0x52, 0xfa, 0xba, 0xe7, 0x52, 0x20, 0x8c, 0x75, 0xce, 0xd3, 0x0b, 0xfb, 0xe8, 0x0e, 0x42, 0xe7,
+  0xaf, 0x76, 0xca, 0x5e, 0xfe, 0x54, 0xb8, 0x6b, 0x1b, 0x86, 0x8b, 0x05, 0xb2, 0xea, 0x88, 0xb9,
+  0x4b, 0xa0, 0xaa, 0xb3, 0x91, 0x53, 0x2c, 0xbd, 0x76, 0x6a, 0x65, 0x7a, 0x29, 0xf7, 0xfc, 0x55,
+  0x27, 0x9a, 0x72, 0xd9, 0xd5, 0x0a, 0x74, 0x2b, 0x1a, 0xb6, 0x9c, 0x78, 0x65, 0xd7, 0x6c, 0x55,
+  0x3a, 0x1b, 0x91, 0xb9, 0x32, 0xf1, 0xe8, 0xcd, 0xd9, 0xc1, 0xd5, 0xf1, 0xf9, 0xd9, 0xc8, 0xe4,
+  0xfc, 0x9e, 0xc6, 0x17, 0xcc, 0xf1, 0x95, 0xad, 0x26, 0x69, 0xe3, 0x1b, 0xcd, 0xda, 0x2c, 0xbc,
+  0x50, 0x2f, 0x35, 0x7d, 0x5f, 0xf3, 0x4b, 0x4b, 0x58, 0xd5, 0x2d, 0xf7, 0x2f, 0x32, 0x95, 0xb6,
+  0x09, 0x38, 0x35, 0xb9, 0xc1, 0x0f, 0x99, 0xd7, 0x9a, 0x09, 0x8a, 0x45, 0x8e, 0xf8, 0x94, 0x5f,
+  0xf4, 0xc5, 0x3d, 0xd1, 0x88, 0x55, 0x9e, 0xb0, 0x9f, 0xc3, 0x0d, 0xdf, 0x77, 0x3e, 0xa8, 0x7a,
+  0x08, 0xdf, 0x34, 0xf4, 0x47, 0xfb, 0xd9, 0x1d, 0x57, 0x1c, 0x1c, 0xd6, 0xad, 0x69, 0xb3, 0x73,
+  0xdf, 0xe0, 0xeb, 0x36, 0xbe, 0x6e, 0xb3, 0xac, 0x6e, 0xf8, 0xd6, 0x89, 0x66, 0xe2, 0x22, 0xb6,
+  0xf5, 0x9a, 0x31, 0x87, 0x69, 0xb9, 0x14, 0xbc, 0xc6, 0xda, 0x85, 0x4b, 0xf1, 0x62, 0x22, 0x4e,
+  0x0c, 0xf0, 0x9a, 0x44, 0x4a, 0x9d, 0x0d, 0x59, 0x3f, 0xbd, 0xe8, 0x37, 0xc9, 0xdb, 0xbd, 0x5f,
+  0x9a, 0x84, 0x46, 0x93, 0x76, 0xa3, 0xd6, 0x28, 0xb2, 0x0b, 0x1f, 0x74, 0x88, 0x53, 0x73, 0xa3,
+  0x1a, 0x9b, 0x8e, 0x97, 0xa9, 0x49, 0xd6, 0xb5, 0x16, 0x97, 0xa9, 0x61, 0x6b, 0x4d, 0x43, 0xe9,
+  0x10, 0xae, 0x96, 0x68, 0x72, 0x26, 0x2b, 0x0c, 0x26, 0x0d, 0xf2, 0xe6, 0xf2, 0x04, 0xd6, 0xc0,
+  0x67, 0xff, 0x13, 0x3d, 0x1f, 0xff, 0x03, 0x06, 0x81, 0xef, 0x4a, 0x23, 0x15, 0x54, 0xae, 0x05,
+  0xe0, 0x83, 0x70, 0x78, 0xe0, 0x2e, 0x85, 0xc3, 0x18, 0xac, 0xb1, 0x67, 0xb3, 0x05, 0x08, 0x9a,
+  0x59, 0xa4, 0xd7, 0x10, 0xe6, 0xa2, 0x75, 0x79, 0xb2, 0x69, 0x80, 0x97, 0x1c, 0xd4, 0x5b, 0xeb,
+  0xea, 0x8f, 0xe3, 0x15, 0x1f, 0xf5, 0x5d, 0xbb, 0xc4, 0xcc, 0xef, 0x5a, 0x45, 0x6b, 0x3f, 0xc9,
+  0x5b, 0xf1, 0xeb, 0x68, 0xa4, 0x55, 0x47, 0xd9, 0x49, 0x94, 0x84, 0xd3, 0x8d, 0x0a, 0x00, 0xe3,
+  0x03, 0x42, 0xe2, 0xe6, 0xeb, 0xa9, 0x8f, 0x16, 0xc3, 0x70, 0x74, 0xb1, 0xd5, 0xdb, 0xdc, 0x34,
+  0x9c, 0x94, 0xa9, 0xad, 0xb3, 0xd9, 0xfc, 0x8c, 0x5d, 0xd8, 0x9e, 0x48, 0x3d, 0xbc, 0xd6, 0xe5,
+  0xcd, 0xe5, 0x31, 0x6c, 0xa3, 0x0b, 0xdf, 0xc3, 0xb0, 0x6a, 0x8a, 0x43, 0x43, 0x2b, 0xdb, 0x05,
+  0x45, 0x1e, 0x48, 0x9a, 0x7a, 0x61, 0x37, 0x7e, 0xed, 0x83, 0xc9, 0x93, 0x54, 0xc8, 0x34, 0xa2,
+  0x01, 0x9e, 0x6e, 0x8a, 0x07, 0x40, 0x12, 0xd9, 0x6a, 0x1d, 0x6e, 0xde, 0x90, 0x5a, 0x46, 0x7e,
+  0x8b, 0xdf, 0x12, 0xc2, 0x0e, 0xb3, 0x30, 0x52, 0xb3, 0x1f, 0x9c, 0x31, 0xf6, 0x92, 0xee, 0xf9,
+  0xa8, 0x37, 0x8a, 0xf1, 0x4b, 0xcf, 0xed, 0x4a, 0xdb, 0x1d, 0x53, 0xfc, 0x05, 0x58, 0xdd, 0xb3,
+  0x53, 0x2c, 0x05, 0x0d, 0x8a, 0xe6, 0x73, 0x89, 0xbf, 0x50, 0xc8, 0xaa, 0xdd, 0x74, 0x26, 0x60,
+  0xc1, 0xd1, 0x7d, 0xcd, 0x76, 0x54, 0xf9, 0x60, 0xbd, 0xf1, 0x0c, 0x7d, 0xc1, 0x39, 0xfa, 0x82,
+  0xf3, 0xf2, 0xf7, 0x06, 0xa1, 0xc8, 0x64, 0x76, 0x2b, 0x0a, 0x45, 0xf6, 0x1c, 0x57, 0x22, 0xfd,
+  0x71, 0xba, 0xd7, 0x8c, 0xb6, 0x50, 0xf0, 0xbc, 0x3f, 0x9e, 0xff, 0x5a, 0x7a, 0x0e, 0x5e, 0x96,
+  0x03, 0x50, 0x58, 0x1c, 0xdc, 0xa6, 0x9f, 0x9d, 0x09, 0x6d, 0x13, 0xb1, 0x03, 0x44, 0xc1, 0x1d,
+  0xb1, 0xae, 0x2d, 0xc7, 0x6b, 0x9b, 0xd4, 0xfc, 0xbd, 0xd9, 0xe6, 0x6d, 0x14, 0x5d, 0xf0, 0xa3,
+  0x29, 0x54, 0x50, 0x9d, 0x9d, 0xb7, 0xe2, 0x0c, 0x8c, 0xc5, 0xcb, 0x23, 0x93, 0xdc, 0x36, 0xaf,
+  0x44, 0x60, 0xee, 0x01, 0x16, 0xa6, 0xce, 0x9d, 0x49, 0xe0, 0xb3, 0x94, 0x7d, 0x5c, 0xf5, 0xae,
+  0xd6, 0x9d, 0x96, 0x95, 0xdb, 0xa0, 0x26, 0xb9, 0xda, 0xbb, 0xbc, 0x12, 0xd6, 0x08, 0x96, 0x10,
+  0xee, 0xef, 0x1d, 0xfc, 0xbd, 0x58, 0x85, 0xb1, 0x2c, 0x07, 0xd2, 0x8e, 0x41, 0x6f, 0xb7, 0xb5,
+  0x54, 0x7a, 0x56, 0x22, 0xa2, 0xaa, 0xad, 0x56, 0x2e, 0x99, 0xa3, 0x5a, 0x79, 0x8f, 0x58, 0x22,
+  0xd9, 0x55, 0x0e, 0xab, 0xea, 0x74, 0x65, 0x53, 0xcd, 0x5d, 0xe1, 0xc0, 0x6d, 0x20, 0xfc, 0xf6,
+  0x30, 0xb5, 0x8f, 0x4b, 0x99, 0x1d, 0xb7, 0x63, 0xd6, 0x09, 0xc5, 0x23, 0x9e, 0xb1, 0xde, 0xae,
+  0xad, 0xa2, 0xf8, 0x99, 0x4a, 0x88, 0x8f, 0x86, 0xa6, 0xba, 0x9f, 0x1f, 0xc8, 0x8b, 0x60, 0xcb,
+  0x9d, 0x27, 0xd5, 0xb5, 0xe0, 0x3e, 0xf2, 0x43, 0x84, 0xda, 0xeb, 0x97, 0x64, 0x1f, 0x2a, 0xbd,
+  0xe1, 0x03, 0xfc, 0x28, 0xe6, 0x45, 0xf1, 0x2d, 0x63, 0x32, 0xb7, 0x77, 0x16, 0xb9, 0x0b, 0xed,
+  0x33, 0x71, 0xc8, 0x1c, 0xd1, 0x1a, 0x99, 0x8a, 0xba, 0x6a, 0xb3, 0x5a, 0x41, 0x73, 0x57, 0xd4,
+  0xd8, 0x95, 0x35, 0xb5, 0x56, 0x43, 0x1b, 0xfd, 0x06, 0xb6, 0x60, 0xce, 0x2f, 0xca, 0xd6, 0x4b,
+  0x35, 0x7d, 0xbc, 0xba, 0x1e, 0x5e, 0x4d, 0xff, 0x16, 0x0b, 0x7b, 0xc1, 0x85, 0x24, 0x2b, 0xca,
+  0x32, 0x07, 0xb3, 0x8a, 0x00, 0x63, 0x1f, 0x8d, 0x00, 0x57, 0x94, 0x51, 0xe4, 0x80, 0x2a, 0xa3,
+  0x08, 0x53, 0x7b, 0xcd, 0x98, 0xc9, 0x00, 0xae, 0xe6, 0xe1, 0x4a, 0x2a, 0x5b, 0x44, 0x23, 0x14,
+  0x47, 0x47, 0x77, 0xab, 0x85, 0xf1, 0xf6, 0x07, 0xf5, 0xa2, 0x8b, 0x27, 0xb8, 0xe0, 0xe2, 0x49,
+  0x2e, 0xb6, 0x78, 0xda, 0x0b, 0x2d, 0x9e, 0xe9, 0xf8, 0x2e, 0x42, 0x75, 0xdc, 0x83, 0x34, 0x31,
+  0x5e, 0xcf, 0xf4, 0x24, 0xc4, 0xa3, 0x99, 0x47, 0x2a, 0x08, 0x7c, 0x00, 0x66, 0xe1, 0xaa, 0xed,
+  0xca, 0x8f, 0xdd, 0x9f, 0x1c, 0x1f, 0x0e, 0x2f, 0xc9, 0xf0, 0x97, 0xe1, 0xd9, 0x15, 0x39, 0x39,
+  0x1e, 0x5d, 0x0d, 0xcf, 0x86, 0x97, 0xa9, 0x4b, 0xae, 0xdc, 0x6d, 0xa3, 0xfa, 0xc6, 0xec, 0xb7,
+  0x64, 0x0c, 0x75, 0x7f, 0xd9, 0x90, 0xae, 0xfe, 0xa2, 0x9c, 0x2c, 0x0d, 0x4b, 0xaf, 0xc5, 0xd1,
+  0x5f, 0xd4, 0x20, 0xce, 0x1b, 0xa1, 0xda, 0xd7, 0xdd, 0xdf, 0xf3, 0x83, 0xee, 0xfe, 0x9e, 0x3c,
+  0xd1, 0xd3, 0x7b, 0x82, 0x80, 0xe4, 0x0c, 0x14, 0x50, 0xf9, 0xe3, 0x7a, 0x8a, 0xd1, 0xcf, 0x00,
+  0x6c, 0xe7, 0xdb, 0x3f, 0xd8, 0xab, 0x6c, 0x5d, 0xbe, 0xce, 0x02, 0xca, 0xde, 0x51, 0xf2, 0x18,
+  0xba, 0x69, 0x6e, 0x3b, 0xc9, 0xce, 0xe4, 0x21, 0xb7, 0x9b, 0xe4, 0x67, 0x2f, 0x6e, 0x5c, 0x81,
+  0xa9, 0xb3, 0xf6, 0x6c, 0xea, 0x02, 0xae, 0x98, 0x37, 0x87, 0x53, 0x3a, 0xef, 0xfc, 0xcd, 0x27,
+  0x8f, 0x99, 0xb9, 0xf6, 0x16, 0x95, 0xec, 0x3c, 0x1e, 0x76, 0x6b, 0x4a, 0x7e, 0xf6, 0xc9, 0x7d,
+  0x2e, 0x99, 0xf9, 0x27, 0xb0, 0x57, 0xa3, 0x80, 0x7a, 0xa5, 0xca, 0x63, 0x68, 0x60, 0xb8, 0xa0,
+  0x45, 0x57, 0xac, 0xb3, 0xfa, 0x05, 0x27, 0xfa, 0xa8, 0x32, 0xbf, 0x83, 0x25, 0x43, 0x0a, 0x69,
+  0x80, 0xd5, 0x88, 0xa1, 0xb9, 0xb1, 0xe5, 0x31, 0xd4, 0x30, 0x5d, 0x00, 0x93, 0x9d, 0xd6, 0x83,
+  0x2f, 0x7c, 0xc9, 0xd3, 0x23, 0x73, 0x29, 0x4d, 0x86, 0x20, 0xf2, 0x10, 0xab, 0x51, 0x04, 0x6f,
+  0x44, 0x36, 0xa8, 0xdb, 0xec, 0xef, 0x57, 0xe9, 0x02, 0x91, 0x18, 0xe9, 0x34, 0x10, 0x4a, 0xfd,
+  0x41, 0x26, 0x51, 0x3c, 0x61, 0x3b, 0xe1, 0x82, 0x9f, 0xd1, 0xaa, 0x4d, 0x5d, 0x2a, 0x97, 0x4f,
+  0x68, 0xf1, 0x4b, 0x6f, 0xea, 0x5a, 0x6d, 0x7c, 0x71, 0xbf, 0xd8, 0x37, 0xf8, 0x6f, 0x96, 0xaa,
+  0x4f, 0x79, 0x9f, 0xd8, 0x43, 0xef, 0x11, 0xcb, 0x73, 0x96, 0x5d, 0x95, 0x86, 0xe9, 0x13, 0xde,
+  0xb3, 0x0b, 0xbd, 0x3a, 0x6c, 0x57, 0xe5, 0x03, 0xd4, 0x2a, 0x70, 0x31, 0x53, 0xcf, 0xc5, 0xc2,
+  0xbd, 0x61, 0xee, 0xc7, 0x29, 0xa4, 0xfa, 0xad, 0xc3, 0xc0, 0xba, 0xbe, 0xd6, 0xda, 0xc6, 0x12,
+  0xd3, 0x35, 0x14, 0x9f, 0xfb, 0xcb, 0x90, 0xe2, 0x0d, 0x37, 0x48, 0x75, 0xaa, 0x25, 0xbb, 0x7e,
+  0x14, 0xd5, 0xdd, 0x34, 0xd5, 0x94, 0x95, 0xee, 0x64, 0x71, 0x9e, 0xcd, 0x80, 0x1d, 0xe6, 0x0e,
+  0x8c, 0xd8, 0x81, 0xbb, 0xa4, 0xc5, 0x50, 0xe7, 0x9b, 0x57, 0x40, 0xb0, 0x42, 0xe8, 0xa1, 0x0c,
+  0xdd, 0xe5, 0xc2, 0x28, 0xc0, 0x95, 0xf8, 0x65, 0x38, 0x8d, 0x50, 0xc4, 0x44, 0x76, 0xe7, 0x2c,
+  0xf3, 0x11, 0xbf, 0x1e, 0x17, 0xdb, 0x6c, 0x10, 0x96, 0x65, 0xc8, 0x17, 0x53, 0xb6, 0x17, 0x01,
+  0x13, 0xcf, 0x43, 0x3a, 0xb5, 0x96, 0x6e, 0x54, 0x7f, 0x04, 0xc3, 0xd9, 0x20, 0x5f, 0x9d, 0xe1,
+  0xe6, 0xb9, 0x94, 0xcd, 0xe7, 0x71, 0xf2, 0xc1, 0x87, 0xf5, 0xec, 0xaf, 0x20, 0x20, 0x49, 0xfe,
+  0x6b, 0xff, 0xcd, 0xd5, 0x95, 0x9c, 0xf5, 0x92, 0x7f, 0x47, 0xa9, 0x40, 0xe3, 0x6a, 0x73, 0x62,
+  0xd2, 0x40, 0x39, 0x3f, 0xb9, 0x12, 0x20, 0xde, 0x3c, 0x0f, 0x24, 0x75, 0xaa, 0x2a, 0x01, 0x51,
+  0x1c, 0x8d, 0xd4, 0x79, 0x90, 0x7f, 0xd4, 0xef, 0x2b, 0x6c, 0x66, 0x1e, 0x9e, 0xdd, 0x29, 0x21,
+  0x7b, 0xf2, 0xa3, 0x80, 0x2b, 0x8e, 0x9f, 0xad, 0x56, 0xc1, 0xbd, 0x68, 0xb8, 0xb1, 0x3f, 0xa8,
+  0xe9, 0x6a, 0xcd, 0x9f, 0x00, 0xcb, 0xe4, 0xa7, 0x07, 0x1f, 0x8b, 0xe5, 0x00, 0xff, 0x7c, 0x3d,
+  0x2c, 0xc5, 0xef, 0xf0, 0xa5, 0x85, 0x22, 0x58, 0x87, 0x91, 0x47, 0x6a, 0xbc, 0xb2, 0xe5, 0x20,
+  0x55, 0xd6, 0x0a, 0x7b, 0xe0, 0x9a, 0x46, 0x98, 0xa5, 0x59, 0x62, 0x90, 0x0d, 0x51, 0xc5, 0x91,
+  0x1a, 0x79, 0xbb, 0xc1, 0x54, 0x24, 0xc6, 0xab, 0xf9, 0x18, 0xa8, 0x36, 0xbb, 0xc3, 0xbf, 0xbe,
+  0xfe, 0xef, 0xf6, 0xf3, 0xf5, 0x6b, 0xe3, 0x3d, 0x15, 0xbc, 0xec, 0xaa, 0xf6, 0x37, 0xf4, 0xa1,
+  0xb5, 0xa1, 0xb5, 0x3a, 0x2f, 0xa3, 0x4a, 0x6a, 0x92, 0x60, 0x04, 0x54, 0x4d, 0x99, 0xaa, 0xac,
+  0x46, 0x3b, 0xc4, 0xdf, 0x32, 0xaa, 0xb7, 0x7a, 0x0d, 0xf2, 0xbc, 0x32, 0x94, 0xee, 0x93, 0x40,
+  0xe9, 0x99, 0xa1, 0xe8, 0xf2, 0xa8, 0xf9, 0x42, 0x2c, 0x73, 0xf1, 0x8e, 0x5e, 0x0e, 0xb2, 0xbf,
+  0x90, 0xb8, 0x22, 0xb3, 0x35, 0x15, 0x27, 0xf9, 0x40, 0xa5, 0x49, 0x81, 0x8e, 0xde, 0x1e, 0x5f,
+  0x0c, 0xc9, 0xab, 0xe1, 0xe8, 0xea, 0xcd, 0xe5, 0x70, 0x94, 0xbd, 0xba, 0x0b, 0x35, 0x37, 0x0b,
+  0xd3, 0xbf, 0x53, 0x2f, 0x08, 0x63, 0x2f, 0x87, 0x9e, 0x9d, 0x7b, 0x25, 0x8a, 0xde, 0x6f, 0x9c,
+  0x05, 0xbd, 0x9a, 0x05, 0x34, 0xc4, 0x6b, 0xe2, 0xa0, 0xc5, 0x56, 0xe7, 0x01, 0x9b, 0x46, 0xe1,
+  0xe6, 0x9e, 0x45, 0x4e, 0xde, 0xdd, 0xe2, 0x4a, 0xf5, 0x17, 0x4f, 0xb2, 0x65, 0x19, 0xc7, 0x16,
+  0x73, 0xa7, 0x6d, 0x1e, 0x86, 0xb2, 0xaf, 0x0a, 0x10, 0xc8, 0x51, 0xe6, 0x30, 0x2d, 0x37, 0x4f,
+  0x41, 0xb5, 0xe4, 0x29, 0xe9, 0xba, 0xf2, 0xfb, 0xbb, 0x5e, 0xf3, 0xc2, 0xf8, 0x9d, 0xf8, 0x3a,
+  0x2f, 0x6e, 0xb1, 0xb3, 0x87, 0x25, 0x95, 0xbe, 0x99, 0xfe, 0x99, 0xd1, 0xb0, 0xe2, 0xb5, 0xa3,
+  0x2d, 0x01, 0x66, 0x91, 0xf9, 0x0c, 0xca, 0x2f, 0x49, 0x2b, 0xc7, 0xdd, 0xef, 0xbf, 0x47, 0xff,
+  0x24, 0x5b, 0xcc, 0xd2, 0xa8, 0x1a, 0x4f, 0x47, 0x5b, 0xac, 0xf8, 0xac, 0x77, 0x76, 0xf8, 0x5d,
+  0xa2, 0x8e, 0xfe, 0xe0, 0xc1, 0x8d, 0xc1, 0xfc, 0x07, 0x99, 0x3e, 0xf9, 0x53, 0x1d, 0x36, 0x18,
+  0x33, 0x2d, 0xbe, 0xa9, 0xd7, 0x1a, 0x0f, 0x5a, 0xd0, 0x12, 0xaa, 0x2a, 0x85, 0x2b, 0x78, 0xc4,
+  0xe2, 0x6c, 0x15, 0xcb, 0x80, 0x70, 0xba, 0x65, 0x96, 0xb0, 0x88, 0x3f, 0xe0, 0x73, 0x26, 0x07,
+  0xbf, 0xaa, 0xab, 0x5c, 0x6a, 0x02, 0x42, 0x9a, 0x6b, 0xf0, 0x34, 0x0b, 0x59, 0x87, 0x85, 0x66,
+  0x39, 0xff, 0xfa, 0xf5, 0x96, 0xb3, 0x3a, 0x49, 0xf3, 0xa2, 0xfe, 0xb5, 0xca, 0xa2, 0xce, 0x03,
+  0x6c, 0xa9, 0x93, 0x2c, 0x59, 0xab, 0x2a, 0x51, 0x76, 0x33, 0x0b, 0xfe, 0x2d, 0x3b, 0x57, 0xd2,
+  0x22, 0x83, 0x0e, 0xbb, 0x44, 0x20, 0xbf, 0x42, 0x61, 0x35, 0x8b, 0x65, 0x29, 0x15, 0xe8, 0xe9,
+  0x96, 0x85, 0x66, 0xe3, 0xd0, 0xac, 0xc8, 0xec, 0x7a, 0x48, 0x56, 0x66, 0xb6, 0xfc, 0x0f, 0xc6,
+  0x53, 0xb1, 0x66, 0x8a, 0x45, 0x45, 0x71, 0xd7, 0xa4, 0x6f, 0x2a, 0x6c, 0x64, 0x15, 0x96, 0x24,
+  0xc6, 0x11, 0xd8, 0xe9, 0x38, 0x7f, 0x19, 0x85, 0x8e, 0xcd, 0x52, 0x04, 0x3c, 0x2d, 0xc8, 0x96,
+  0x42, 0x58, 0x45, 0x68, 0x92, 0xd5, 0x69, 0x76, 0xc8, 0x72, 0xb3, 0xff, 0x26, 0x5b, 0x45, 0xe9,
+  0x7b, 0x91, 0xe5, 0x78, 0x21, 0x3a, 0x5e, 0xac, 0x5e, 0xad, 0x81, 0x6d, 0x94, 0x09, 0x7f, 0x13,
+  0xbf, 0x96, 0x2a, 0x07, 0x93, 0xae, 0xf2, 0xa1, 0x43, 0xec, 0xbe, 0x62, 0x6f, 0xb5, 0x1a, 0xf9,
+  0x49, 0x48, 0xae, 0x15, 0x58, 0xa5, 0x9a, 0x11, 0x09, 0xa2, 0x29, 0x8f, 0xd4, 0x51, 0x45, 0xe3,
+  0x8c, 0xf2, 0x97, 0xec, 0xc2, 0xbf, 0xcc, 0x6f, 0xe7, 0xa2, 0x90, 0x29, 0x2f, 0xd3, 0x9f, 0xc4,
+  0xd5, 0x51, 0x58, 0x6d, 0x9f, 0xfe, 0xf0, 0x6d, 0x1e, 0x5c, 0x52, 0xaf, 0x68, 0x26, 0x54, 0xc9,
+  0xf6, 0x71, 0xbf, 0xf2, 0xe9, 0x49, 0x9b, 0x3b, 0xdc, 0xdc, 0xb6, 0x7e, 0x56, 0x31, 0x3f, 0x9d,
+  0x77, 0x52, 0x44, 0x88, 0x4f, 0x73, 0x22, 0x2d, 0xad, 0xb7, 0xb8, 0x03, 0xd1, 0x9e, 0x13, 0x27,
+  0x19, 0xde, 0x26, 0xe1, 0x72, 0x32, 0xa1, 0x61, 0x38, 0x5d, 0xba, 0x6e, 0x26, 0x2f, 0x7f, 0xcf,
+  0xce, 0x47, 0x89, 0x07, 0x2f, 0xd7, 0xc3, 0x49, 0xe0, 0x2c, 0xa2, 0xdd, 0x67, 0x2f, 0xd7, 0xc7,
+  0xbe, 0x7d, 0x87, 0xff, 0xce, 0xa2, 0xb9, 0xbb, 0xfb, 0xec, 0x7f, 0x00, 0x16, 0x5b, 0x80, 0x64,
+  0x47, 0xda, 0x00, 0x00,
+};
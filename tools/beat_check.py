@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+"""Run the lamp's beat tracker on a WAV file.
+
+    python3 tools/beat_check.py song.wav
+    python3 tools/beat_check.py song.wav --expect 128     # exit 1 if the BPM is off
+    python3 tools/beat_check.py --click 120               # synthetic kick track
+
+The audio goes through the same steps as the microphone path in the
+firmware and then through a line-by-line port of the BEAT TRACKING
+section, using the same integer maths. Like the lamp, A0 is read about
+256 times a second from loop(): each read lands up to --jitter ms late,
+with no filter in front, so everything above 128 Hz folds into the bass
+bands unless --lowpass models a capacitor on A0. A 32 sample Hann FFT
+runs every 8 reads, giving 8 bands and AGC. Keep both in step when
+tuning the ONSET_* / BEAT_* constants.
+"""
+import argparse
+import cmath
+import math
+import random
+import struct
+import sys
+import wave
+
+# Microphone path
+MIC_SAMPLE_RATE = 256
+FFT_SIZE = 32
+MIC_HOP = 8
+MIC_NOISE_FLOOR = 24
+MIC_AGC_DECAY = 128
+BAND_EDGES = [1, 2, 3, 4, 5, 6, 8, 11, 16]
+AUDIO_BANDS = 8
+
+# Beat tracking
+ONSET_HISTORY = 16
+ONSET_SENSITIVITY = 160
+ONSET_MIN_FLUX = 24
+ONSET_REFRACTORY = 120
+BEAT_MIN_PERIOD = 300
+BEAT_MAX_PERIOD = 1000
+BEAT_MIN_INTERVAL = 150
+BEAT_MAX_INTERVAL = 2000
+BEAT_BIN_MS = 10
+BEAT_BINS = (BEAT_MAX_INTERVAL - BEAT_MIN_INTERVAL) // BEAT_BIN_MS + 1
+BEAT_ONSETS = 8
+BEAT_LOCK_ONSETS = 4
+BEAT_LOST_TIMEOUT = 4000
+
+
+def c_div(a, b):
+    # C integer division truncates towards zero
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def c_mod(a, b):
+    return a - c_div(a, b) * b
+
+
+class BeatTracker:
+    def __init__(self):
+        self.prev_bands = [0] * AUDIO_BANDS
+        self.flux_history = [0] * ONSET_HISTORY
+        self.flux_index = 0
+        self.flux_sum = 0
+        self.onset_times = [0] * BEAT_ONSETS
+        self.onset_index = 0
+        self.onsets_since_lock = 0
+        self.last_onset = 0
+        self.interval_votes = [0] * BEAT_BINS
+        self.beat_period = 500
+        self.next_beat = 0
+        self.locked = False
+        self.onsets = 0
+        self.phase_errors = []
+
+    def vote_interval(self, interval, weight):
+        if interval < BEAT_MIN_INTERVAL or interval > BEAT_MAX_INTERVAL:
+            return
+        votes = self.interval_votes
+        b = min((interval - BEAT_MIN_INTERVAL + BEAT_BIN_MS // 2) // BEAT_BIN_MS, BEAT_BINS - 1)
+        votes[b] = (votes[b] + weight * 2) & 0xFFFF
+        if b > 0:
+            votes[b - 1] = (votes[b - 1] + weight) & 0xFFFF
+        if b + 1 < BEAT_BINS:
+            votes[b + 1] = (votes[b + 1] + weight) & 0xFFFF
+
+    def tempo_score(self, period):
+        score = 0
+        k = 1
+        while k * period <= BEAT_MAX_INTERVAL:
+            score += self.interval_votes[(k * period - BEAT_MIN_INTERVAL) // BEAT_BIN_MS] * 12 // k
+            k += 1
+        return score
+
+    def track_tempo(self, now):
+        self.interval_votes = [v - (v >> 4) for v in self.interval_votes]
+        for i in range(1, BEAT_ONSETS + 1):
+            previous = self.onset_times[(self.onset_index + BEAT_ONSETS - i) % BEAT_ONSETS]
+            if previous == 0:
+                break
+            self.vote_interval(now - previous, 4 if i <= 2 else 2)
+        self.onset_times[self.onset_index] = now
+        self.onset_index = (self.onset_index + 1) % BEAT_ONSETS
+
+        best = best_score = 0
+        for period in range(BEAT_MIN_PERIOD, BEAT_MAX_PERIOD + 1, BEAT_BIN_MS):
+            score = self.tempo_score(period)
+            if score > best_score:
+                best, best_score = period, score
+        if best_score == 0:
+            return
+
+        span = beats_in_span = 0
+        for i in range(2, BEAT_ONSETS + 1):
+            previous = self.onset_times[(self.onset_index + BEAT_ONSETS - i) % BEAT_ONSETS]
+            if previous == 0:
+                break
+            interval = now - previous
+            count = (interval + best // 2) // best
+            if count > 0 and abs(interval - count * best) < best // 4:
+                span += interval
+                beats_in_span += count
+        period = span // beats_in_span if beats_in_span else best
+        change = period - self.beat_period
+        self.beat_period = period if abs(change) > 40 else self.beat_period + c_div(change, 4)
+
+    def lock_beat(self, now):
+        if not self.locked:
+            self.onsets_since_lock += 1
+            if self.onsets_since_lock < BEAT_LOCK_ONSETS:
+                return
+            self.locked = True
+            self.next_beat = now + self.beat_period
+            return
+        error = c_mod(now - (self.next_beat - self.beat_period), self.beat_period)
+        if error < 0:
+            error += self.beat_period
+        if error > self.beat_period // 2:
+            error -= self.beat_period
+        self.phase_errors.append(error)
+        if abs(error) < self.beat_period // 4:
+            self.next_beat += c_div(error, 4)
+
+    def detect_onset(self, bands, now):
+        flux = 0
+        for i in range(AUDIO_BANDS):
+            if bands[i] > self.prev_bands[i]:
+                flux += (bands[i] - self.prev_bands[i]) * (2 if i < 2 else 1)
+            self.prev_bands[i] = bands[i]
+
+        average = self.flux_sum // ONSET_HISTORY
+        self.flux_sum += flux - self.flux_history[self.flux_index]
+        self.flux_history[self.flux_index] = flux
+        self.flux_index = (self.flux_index + 1) % ONSET_HISTORY
+
+        if (flux < ONSET_MIN_FLUX or flux * 100 <= average * ONSET_SENSITIVITY
+                or now - self.last_onset < ONSET_REFRACTORY):
+            return False
+        self.last_onset = now
+        self.onsets += 1
+        self.track_tempo(now)
+        self.lock_beat(now)
+        return True
+
+    def update_clock(self, now):
+        if self.locked and now - self.last_onset > BEAT_LOST_TIMEOUT:
+            self.locked = False
+            self.onsets_since_lock = 0
+        if not self.locked:
+            return 0
+        ticks = 0
+        while now - self.next_beat >= 0:
+            self.next_beat += self.beat_period
+            ticks += 1
+        return ticks
+
+
+def fft(values):
+    n = len(values)
+    if n == 1:
+        return list(values)
+    even = fft(values[0::2])
+    odd = fft(values[1::2])
+    out = [0] * n
+    for k in range(n // 2):
+        t = cmath.exp(-2j * math.pi * k / n) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+class MicAnalyser:
+    """Float version of analyseMicFrame() - same bands, scaling and AGC."""
+
+    def __init__(self):
+        self.window = [0.5 - 0.5 * math.cos(2 * math.pi * i / (FFT_SIZE - 1)) for i in range(FFT_SIZE)]
+        self.agc_peak = MIC_NOISE_FLOOR
+
+    def bands(self, samples):
+        bias = sum(samples) / FFT_SIZE
+        spectrum = fft([(s - bias) * 32 * w for s, w in zip(samples, self.window)])
+        raw = []
+        for band in range(AUDIO_BANDS):
+            peak = 0
+            for b in range(BAND_EDGES[band], BAND_EDGES[band + 1]):
+                re = abs(spectrum[b].real) / FFT_SIZE
+                im = abs(spectrum[b].imag) / FFT_SIZE
+                peak = max(peak, int(re + im / 2 if re > im else im + re / 2))
+            raw.append(peak)
+        loudest = max(raw)
+        self.agc_peak -= self.agc_peak // MIC_AGC_DECAY
+        self.agc_peak = max(self.agc_peak, loudest, MIC_NOISE_FLOOR)
+        if loudest < MIC_NOISE_FLOOR:
+            return None
+        return [min(255, r * 255 // self.agc_peak) for r in raw]
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as wav:
+        channels = wav.getnchannels()
+        width = wav.getsampwidth()
+        rate = wav.getframerate()
+        data = wav.readframes(wav.getnframes())
+    if width != 2:
+        sys.exit("only 16 bit PCM WAV files are supported")
+    samples = struct.unpack("<%dh" % (len(data) // 2), data)
+    mono = [sum(samples[i:i + channels]) / channels for i in range(0, len(samples), channels)]
+    return mono, rate
+
+
+def click_track(bpm, seconds, rate=16000):
+    # Decaying 60 Hz kick on every beat, a hi-hat on the off-beats, noise
+    samples = [0.0] * int(seconds * rate)
+    period = int(rate * 60 / bpm)
+    for start in range(0, len(samples), period):
+        for i in range(int(rate * 0.15)):
+            if start + i < len(samples):
+                samples[start + i] += 12000 * math.exp(-i / (rate * 0.04)) * math.sin(2 * math.pi * 60 * i / rate)
+        hat = start + period // 2
+        for i in range(int(rate * 0.03)):
+            if hat + i < len(samples):
+                samples[hat + i] += 3000 * math.exp(-i / (rate * 0.008)) * random.uniform(-1, 1)
+    return [s + random.uniform(-300, 300) for s in samples], rate
+
+
+def lowpass(samples, rate, cutoff):
+    # One-pole RC filter in front of A0
+    alpha = 1 - math.exp(-2 * math.pi * cutoff / rate)
+    out = []
+    level = samples[0] if samples else 0
+    for s in samples:
+        level += alpha * (s - level)
+        out.append(level)
+    return out
+
+
+def sample_adc(samples, rate, jitter_ms):
+    # Point samples like analogRead() from loop(): on the MIC_SAMPLE_RATE
+    # grid, each one late by up to jitter_ms, scaled to ADC counts
+    out = []
+    k = 0
+    while True:
+        index = int((k / MIC_SAMPLE_RATE + random.uniform(0, jitter_ms / 1000.0)) * rate)
+        if index >= len(samples):
+            return out
+        out.append(512 + samples[index] / 64)
+        k += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("wav", nargs="?", help="16 bit PCM WAV file")
+    parser.add_argument("--click", type=float, help="analyse a synthetic kick track at this BPM instead")
+    parser.add_argument("--seconds", type=float, default=30, help="length of the synthetic track")
+    parser.add_argument("--expect", type=float, help="expected BPM, exit 1 when further off than --tolerance")
+    parser.add_argument("--tolerance", type=float, default=2.0)
+    parser.add_argument("--jitter", type=float, default=1.0, help="ms each A0 read may be late (loop() timing)")
+    parser.add_argument("--lowpass", type=float, default=0, help="RC filter on A0 at this many Hz, 0 = none")
+    args = parser.parse_args()
+
+    if args.click:
+        samples, rate = click_track(args.click, args.seconds)
+        expect = args.expect or args.click
+    elif args.wav:
+        samples, rate = read_wav(args.wav)
+        expect = args.expect
+    else:
+        parser.error("give a WAV file or --click BPM")
+
+    if args.lowpass:
+        samples = lowpass(samples, rate, args.lowpass)
+    adc = sample_adc(samples, rate, args.jitter)
+    analyser = MicAnalyser()
+    tracker = BeatTracker()
+    frame_ms = 1000.0 * MIC_HOP / MIC_SAMPLE_RATE
+    beats = 0
+    locked_frames = 0
+    frames = max(0, (len(adc) - FFT_SIZE) // MIC_HOP + 1)
+    lock_time = None
+
+    for frame in range(frames):
+        start = frame * MIC_HOP
+        now = int((start + FFT_SIZE) * 1000.0 / MIC_SAMPLE_RATE) + 1  # millis() at the last read, never 0
+        levels = analyser.bands(adc[start:start + FFT_SIZE])
+        if levels is not None:
+            tracker.detect_onset(levels, now)
+        beats += tracker.update_clock(now)
+        if tracker.locked:
+            locked_frames += 1
+            if lock_time is None:
+                lock_time = now / 1000.0
+
+    bpm = 60000.0 / tracker.beat_period
+    errors = tracker.phase_errors[len(tracker.phase_errors) // 2:] or [0]
+    print("frames:       %d (%.1f s)" % (frames, frames * frame_ms / 1000))
+    print("onsets:       %d" % tracker.onsets)
+    print("beats:        %d" % beats)
+    print("bpm:          %.1f" % bpm)
+    print("locked:       %.0f%% of frames, first lock at %s s"
+          % (100.0 * locked_frames / max(frames, 1), "%.1f" % lock_time if lock_time else "-"))
+    print("phase error:  %.0f ms mean |error| over the second half"
+          % (sum(abs(e) for e in errors) / len(errors)))
+
+    if expect is not None and abs(bpm - expect) > args.tolerance:
+        print("FAIL: expected %.1f BPM" % expect)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Stream a test animation to the lamp over DDP or E1.31 (sACN).
+
+    python3 tools/ddp_send.py                      # DDP rainbow to 192.168.4.1
+    python3 tools/ddp_send.py --e131 --fps 60
+    python3 tools/ddp_send.py --drop 10            # skip every 10th packet
+
+Compare the lamp's /stats (realtimeFps, realtimeLost, realtimeLatency*)
+with the rate and drops used here. Stop the script and the lamp returns to
+its own effect: at once for E1.31 (the script sends Stream_Terminated),
+after the realtime timeout for DDP.
+"""
+import argparse
+import colorsys
+import socket
+import struct
+import time
+import uuid
+
+DDP_PORT = 4048
+E131_PORT = 5568
+E131_PREVIEW = 0x80      # Framing layer options
+E131_TERMINATED = 0x40
+
+
+def ddp_packet(sequence, pixels):
+    # Version 1, push flag set, sequence 1..15, RGB 8 bit, output device 1
+    header = struct.pack("!BBBBLH", 0x41, sequence, 0x0B, 1, 0, len(pixels))
+    return header + pixels
+
+
+def e131_packet(sequence, universe, cid, pixels, options=0):
+    dmx = b"\x00" + pixels  # Null start code + levels
+    dmp = struct.pack("!HBBHHH", 0x7000 | (10 + len(dmx)), 0x02, 0xA1, 0, 1, len(dmx)) + dmx
+    framing = (struct.pack("!HL", 0x7000 | (77 + len(dmp)), 0x00000002)
+               + b"ddp_send.py".ljust(64, b"\x00")
+               + struct.pack("!BHBBH", 100, 0, sequence, options, universe) + dmp)
+    root = (struct.pack("!HH", 0x0010, 0x0000) + b"ASC-E1.17\x00\x00\x00"
+            + struct.pack("!HL", 0x7000 | (22 + len(framing)), 0x00000004) + cid + framing)
+    return root
+
+
+def rainbow(frame, leds):
+    data = bytearray()
+    for i in range(leds):
+        r, g, b = colorsys.hsv_to_rgb(((frame * 2 + i * 85) % 256) / 256.0, 1.0, 1.0)
+        data += bytes((int(r * 255), int(g * 255), int(b * 255)))
+    return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--leds", type=int, default=3)
+    parser.add_argument("--fps", type=float, default=40.0)
+    parser.add_argument("--seconds", type=float, default=0, help="0 = run until Ctrl+C")
+    parser.add_argument("--e131", action="store_true", help="send E1.31 instead of DDP")
+    parser.add_argument("--universe", type=int, default=1)
+    parser.add_argument("--drop", type=int, default=0, help="skip every Nth packet")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    cid = uuid.uuid4().bytes
+    interval = 1.0 / args.fps
+    start = time.monotonic()
+    next_frame = start
+    frame = sent = skipped = 0
+
+    try:
+        while not args.seconds or time.monotonic() - start < args.seconds:
+            pixels = rainbow(frame, args.leds)
+            if args.e131:
+                packet = e131_packet(frame & 0xFF, args.universe, cid, pixels)
+                port = E131_PORT
+            else:
+                packet = ddp_packet(frame % 15 + 1, pixels)
+                port = DDP_PORT
+
+            if args.drop and frame % args.drop == args.drop - 1:
+                skipped += 1
+            else:
+                sock.sendto(packet, (args.host, port))
+                sent += 1
+
+            frame += 1
+            next_frame += interval
+            time.sleep(max(0.0, next_frame - time.monotonic()))
+    except KeyboardInterrupt:
+        pass
+
+    if args.e131:
+        # The standard asks for three terminate packets
+        for i in range(3):
+            sock.sendto(e131_packet((frame + i) & 0xFF, args.universe, cid, rainbow(frame, args.leds),
+                                    E131_TERMINATED), (args.host, E131_PORT))
+
+    elapsed = time.monotonic() - start
+    print("sent %d packets (%d skipped) in %.1f s = %.1f fps" %
+          (sent, skipped, elapsed, sent / elapsed if elapsed else 0))
+
+
+if __name__ == "__main__":
+    main()
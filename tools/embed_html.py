@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Build step: gzip the web page for serving straight from flash.
+
+Extracts the index_html raw literal from "Optic RGB code.cpp", compresses it
+and writes index_html_gz.h next to the sketch. Re-run after every change to
+the web page:
+
+    python3 tools/embed_html.py
+"""
+import gzip
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCH = os.path.join(ROOT, "Optic RGB code.cpp")
+OUTPUT = os.path.join(ROOT, "index_html_gz.h")
+
+
+def extract_page(source):
+    match = re.search(r'index_html\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral"',
+                      source, re.S)
+    if not match:
+        sys.exit("index_html raw literal not found in " + SKETCH)
+    return match.group(1).encode("utf-8")
+
+
+def main():
+    with open(SKETCH, encoding="utf-8") as f:
+        page = extract_page(f.read())
+
+    # mtime=0 keeps the output byte-identical for identical input
+    packed = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = "%08x" % (zlib.crc32(page) & 0xFFFFFFFF)
+
+    lines = [
+        "// Generated by tools/embed_html.py from index_html in \"Optic RGB code.cpp\".",
+        "// Do not edit by hand - re-run the script after changing the web page.",
+        "#pragma once",
+        "",
+        "// Page: %d bytes, gzip: %d bytes" % (len(page), len(packed)),
+        "#define INDEX_HTML_ETAG \"\\\"%s\\\"\"" % etag,
+        "const size_t index_html_gz_len = %d;" % len(packed),
+        "const uint8_t index_html_gz[] PROGMEM = {",
+    ]
+    for i in range(0, len(packed), 16):
+        chunk = packed[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+    print("index_html: %d bytes -> %d bytes gzip (%.1f%%), ETag %s" %
+          (len(page), len(packed), 100.0 * len(packed) / len(page), etag))
+
+
+if __name__ == "__main__":
+    main()
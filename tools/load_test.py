@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Load the lamp with concurrent clients and report command latency percentiles.
+
+    python3 tools/load_test.py                        # 4 clients for 30 s against 192.168.4.1
+    python3 tools/load_test.py --clients 8 --page-loaders 2 --seconds 60
+
+Each client sends brightness and color commands back to back, each on a
+new connection. --page-loaders more clients download the page at the same
+time. Printed are the round trips seen here (p50/p90/p99) next to what
+/stats reports afterwards: commandLatencyP*Us (queued to applied on the
+lamp, log2 buckets, counted since boot) and maxFrameGapUs.
+"""
+import argparse
+import http.client
+import random
+import threading
+import time
+
+
+def get(host, port, path, headers=None):
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    try:
+        conn.request("GET", path, headers=headers or {})
+        response = conn.getresponse()
+        response.read()
+        return response.status
+    finally:
+        conn.close()
+
+
+def read_stats(host, port):
+    conn = http.client.HTTPConnection(host, port, timeout=5)
+    conn.request("GET", "/stats")
+    body = conn.getresponse().read().decode(errors="replace")
+    conn.close()
+    stats = {}
+    for line in body.splitlines():
+        key, _, value = line.partition(":")
+        if value.strip():
+            stats[key.strip()] = value.strip()
+    return stats
+
+
+def percentile(values, percent):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * percent / 100))]
+
+
+class Client(threading.Thread):
+    def __init__(self, args, deadline, page):
+        super().__init__(daemon=True)
+        self.args = args
+        self.deadline = deadline
+        self.page = page
+        self.latencies = []
+        self.errors = 0
+
+    def next_path(self):
+        if self.page:
+            return "/"
+        if random.random() < 0.5:
+            return "/brightness?val=%d" % random.randint(10, 255)
+        return "/color?hex=%06X" % random.randint(0, 0xFFFFFF)
+
+    def run(self):
+        headers = {"Accept-Encoding": "gzip"}
+        while time.monotonic() < self.deadline:
+            start = time.monotonic()
+            try:
+                status = get(self.args.host, self.args.port, self.next_path(), headers)
+                if status != 200:
+                    self.errors += 1
+                    continue
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                time.sleep(0.2)
+                continue
+            self.latencies.append((time.monotonic() - start) * 1000)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4, help="clients sending commands")
+    parser.add_argument("--page-loaders", type=int, default=0, help="clients loading the page meanwhile")
+    parser.add_argument("--seconds", type=float, default=30)
+    args = parser.parse_args()
+
+    deadline = time.monotonic() + args.seconds
+    clients = [Client(args, deadline, False) for _ in range(args.clients)]
+    loaders = [Client(args, deadline, True) for _ in range(args.page_loaders)]
+    for client in clients + loaders:
+        client.start()
+    for client in clients + loaders:
+        client.join()
+
+    commands = [ms for client in clients for ms in client.latencies]
+    pages = [ms for client in loaders for ms in client.latencies]
+    errors = sum(client.errors for client in clients + loaders)
+    print("%d commands (%.0f/s), %d page loads, %d errors" % (
+        len(commands), len(commands) / args.seconds, len(pages), errors))
+    print("command round trip   p50 %6.1f ms  p90 %6.1f ms  p99 %6.1f ms" % (
+        percentile(commands, 50), percentile(commands, 90), percentile(commands, 99)))
+    if pages:
+        print("page load            p50 %6.1f ms  p90 %6.1f ms  p99 %6.1f ms" % (
+            percentile(pages, 50), percentile(pages, 90), percentile(pages, 99)))
+
+    stats = read_stats(args.host, args.port)
+    print("lamp queued->applied p50 %6.2f ms  p90 %6.2f ms  p99 %6.2f ms  (since boot)" % tuple(
+        int(stats.get(key, 0)) / 1000 for key in
+        ("commandLatencyP50Us", "commandLatencyP90Us", "commandLatencyP99Us")))
+    print("lamp longest loop gap %.1f ms" % (int(stats.get("maxFrameGapUs", 0)) / 1000))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Analyse a song into a lamp music timeline.
+
+    python3 tools/make_timeline.py song.wav                      # writes song.otl
+    python3 tools/make_timeline.py song.wav --upload 192.168.4.1 # and sends it to the lamp
+
+The song is cut into --frame-ms frames of 8 band levels (same bands as the
+web page analyser, in dB so quiet passages still move). Onsets from the
+lamp's own beat tracker (beat_check.py) give the tempo, and one beat grid
+is fitted to the whole song, so beats land exactly on time from the first
+bar. Every 4th beat is a bar, and a new section starts where the energy of
+4 bars differs from the last 4 by more than --section-change.
+
+Pick the same file in the page to play it: the lamp plays the timeline
+whenever the song name matches the name stored here (--name).
+"""
+import argparse
+import math
+import os
+import struct
+import sys
+import urllib.request
+
+from beat_check import AUDIO_BANDS, BeatTracker, fft, read_wav
+
+TIMELINE_MAGIC = 0x314C544F  # "OTL1"
+HEADER_FORMAT = "<IHHI48s"   # struct TimelineHeader
+FLAG_BEAT = 0x01
+FLAG_BAR = 0x02
+FLAG_SECTION = 0x04
+
+ANALYSIS_RATE = 8192
+WINDOW = 512
+BAND_EDGES_HZ = [20, 60, 150, 300, 600, 1200, 2400, 4000, 4096]
+DB_RANGE = 60.0
+BEATS_PER_BAR = 4
+SECTION_BARS = 4
+MIN_SECTION_BARS = 8
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+def downsample(samples, rate):
+    # Box filter down to ANALYSIS_RATE - plenty for the top band
+    if rate <= ANALYSIS_RATE:
+        return list(samples)
+    step = rate / ANALYSIS_RATE
+    out = []
+    position = 0.0
+    while position + step <= len(samples):
+        chunk = samples[int(position):int(position + step)]
+        out.append(sum(chunk) / len(chunk))
+        position += step
+    return out
+
+
+def magnitudes(chunk, window):
+    values = [s * w for s, w in zip(chunk, window)]
+    if numpy is not None:
+        return list(numpy.abs(numpy.fft.rfft(values)))
+    return [abs(c) for c in fft(values)[:WINDOW // 2 + 1]]
+
+
+def band_powers(samples, frame_ms):
+    window = [0.5 - 0.5 * math.cos(2 * math.pi * i / (WINDOW - 1)) for i in range(WINDOW)]
+    hop = ANALYSIS_RATE * frame_ms / 1000.0
+    bin_hz = ANALYSIS_RATE / WINDOW
+    edges = [max(1, int(round(hz / bin_hz))) for hz in BAND_EDGES_HZ]
+    frames = int(len(samples) / hop)
+    padded = [0.0] * (WINDOW // 2) + samples + [0.0] * WINDOW
+    powers = []
+    for frame in range(frames):
+        start = int(frame * hop)  # window centred on the frame time
+        spectrum = magnitudes(padded[start:start + WINDOW], window)
+        powers.append([max(spectrum[edges[b]:max(edges[b + 1], edges[b] + 1)]) for b in range(AUDIO_BANDS)])
+    return powers
+
+
+def to_levels(powers):
+    # dB below each band's loudest frame, DB_RANGE mapped onto 0..255
+    peaks = [max(p[b] for p in powers) or 1.0 for b in range(AUDIO_BANDS)]
+    levels = []
+    for p in powers:
+        row = []
+        for b in range(AUDIO_BANDS):
+            db = 20 * math.log10(max(p[b], 1e-9) / peaks[b])
+            row.append(max(0, min(255, int((db + DB_RANGE) * 255 / DB_RANGE))))
+        levels.append(row)
+    return levels
+
+
+def linear_levels(powers):
+    # What the lamp's analyser would see - one gain for all bands
+    peak = max(max(p) for p in powers) or 1.0
+    return [[min(255, int(v * 255 / peak)) for v in p] for p in powers]
+
+
+def find_onsets(levels, frame_ms):
+    # Onset times with their bass rise, so the grid prefers kicks to hi-hats
+    tracker = BeatTracker()
+    onsets = []
+    periods = []
+    for frame, row in enumerate(levels):
+        now = frame * frame_ms + 1  # never 0, like millis() in the tracker
+        if tracker.detect_onset(row, now):
+            previous = levels[frame - 1] if frame else [0] * AUDIO_BANDS
+            weight = 1 + max(0, row[0] - previous[0]) + max(0, row[1] - previous[1])
+            onsets.append((now - 1, weight))
+            if tracker.locked:
+                periods.append(tracker.beat_period)
+    return onsets, periods
+
+
+def fit_grid(onsets, period, frame_ms):
+    # Phase of the beat grid that the strongest onsets fall close to
+    best_phase, best_score = 0, -1
+    for phase in range(0, period, max(1, frame_ms // 2)):
+        score = 0
+        for t, weight in onsets:
+            error = (t - phase) % period
+            error = min(error, period - error)
+            if error < period // 8:
+                score += (period // 8 - error) * weight
+        if score > best_score:
+            best_phase, best_score = phase, score
+
+    # The tracker's period is whole milliseconds, which drifts a beat or so
+    # over a song - fit phase and period to the onsets on the grid instead
+    phase = float(best_phase)
+    period = float(period)
+    for _ in range(3):
+        points = []
+        for t, weight in onsets:
+            beat = round((t - phase) / period)
+            if abs(t - phase - beat * period) < period / 8:
+                points.append((beat, t, weight))
+        total = sum(w for _, _, w in points)
+        if len(points) < 2 or total == 0:
+            break
+        mean_beat = sum(b * w for b, _, w in points) / total
+        mean_time = sum(t * w for _, t, w in points) / total
+        spread = sum(w * (b - mean_beat) ** 2 for b, _, w in points)
+        if spread == 0:
+            break
+        period = sum(w * (b - mean_beat) * (t - mean_time) for b, t, w in points) / spread
+        phase = (mean_time - mean_beat * period) % period
+    return phase, period
+
+
+def build_timeline(levels, frame_ms, period, phase, section_change):
+    frames = len(levels)
+    flags = [0] * frames
+    beat_frames = []
+    t = phase
+    while t < frames * frame_ms:
+        beat_frames.append(int(round(t / frame_ms)) if t < (frames - 0.5) * frame_ms else frames - 1)
+        t += period
+    for f in beat_frames:
+        flags[f] |= FLAG_BEAT
+
+    # Bars start on the beat of the four with the strongest bass on average
+    bass = [levels[f][0] + levels[f][1] for f in beat_frames]
+    offset = max(range(BEATS_PER_BAR),
+                 key=lambda o: sum(bass[o::BEATS_PER_BAR]) / max(1, len(bass[o::BEATS_PER_BAR])))
+    bars = beat_frames[offset::BEATS_PER_BAR]
+    for f in bars:
+        flags[f] |= FLAG_BAR
+
+    # Sections: compare the energy of each SECTION_BARS block with the last
+    sections = [0] * frames
+    section = 0
+    last_energy = None
+    last_start = -MIN_SECTION_BARS
+    for i in range(0, len(bars) - SECTION_BARS + 1, SECTION_BARS):
+        start, end = bars[i], bars[i + SECTION_BARS] if i + SECTION_BARS < len(bars) else frames
+        energy = sum(sum(row) for row in levels[start:end]) / max(1, end - start)
+        if (last_energy is not None and i - last_start >= MIN_SECTION_BARS and
+                abs(energy - last_energy) > section_change * max(last_energy, 1)):
+            section = (section + 1) & 0xFF
+            flags[start] |= FLAG_SECTION
+            last_start = i
+        for f in range(start, frames):
+            sections[f] = section
+        last_energy = energy
+
+    return flags, sections
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("wav", help="16 bit PCM WAV file")
+    parser.add_argument("--name", help="song the page plays it for (default: file name without extension)")
+    parser.add_argument("--out", help="output file (default: song.otl)")
+    parser.add_argument("--frame-ms", type=int, default=20)
+    parser.add_argument("--bpm", type=float, help="use this tempo instead of the tracked one")
+    parser.add_argument("--section-change", type=float, default=0.25)
+    parser.add_argument("--upload", metavar="HOST", help="POST the timeline to http://HOST/timeline")
+    args = parser.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.wav))[0]
+    # Keep the name printable in the lamp's JSON reply
+    name = "".join(c for c in name if c not in '"\\' and 32 <= ord(c) < 127)
+    encoded = name.encode()[:47]
+
+    samples, rate = read_wav(args.wav)
+    powers = band_powers(downsample(samples, rate), args.frame_ms)
+    levels = to_levels(powers)
+    onsets, periods = find_onsets(linear_levels(powers), args.frame_ms)
+    if args.bpm:
+        period = int(round(60000 / args.bpm))
+    elif periods:
+        period = sorted(periods)[len(periods) // 2]
+    else:
+        sys.exit("no steady beat found - give the tempo with --bpm")
+    phase, period = fit_grid(onsets, period, args.frame_ms)
+    flags, sections = build_timeline(levels, args.frame_ms, period, phase, args.section_change)
+
+    data = bytearray(struct.pack(HEADER_FORMAT, TIMELINE_MAGIC, args.frame_ms, int(round(period)),
+                                 len(levels), encoded))
+    for row, flag, section in zip(levels, flags, sections):
+        data += bytes(row) + bytes((flag, section))
+
+    out = args.out or os.path.splitext(args.wav)[0] + ".otl"
+    with open(out, "wb") as f:
+        f.write(data)
+    print("%s: \"%s\" %d frames of %d ms, %.1f BPM, %d sections, %d bytes"
+          % (out, name, len(levels), args.frame_ms, 60000.0 / period, max(sections) + 1, len(data)))
+
+    if args.upload:
+        request = urllib.request.Request("http://%s/timeline" % args.upload, data=bytes(data),
+                                         headers={"Content-Type": "application/octet-stream"})
+        with urllib.request.urlopen(request, timeout=30) as reply:
+            print(reply.read().decode())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Time page loads from the lamp, plain and gzip, and the loop stall they cause.
+
+    python3 tools/page_load.py                     # 20 loads of each from 192.168.4.1
+    python3 tools/page_load.py --loads 50 --host 192.168.1.42
+
+Each load fetches / in full with a fresh connection (no ETag, so never a
+304) and then reads pageLoadFrameGapUs from /stats: the longest gap
+between two loop() passes while that page was going out. The plain page
+stands in for the old uncompressed handler.
+"""
+import argparse
+import http.client
+import statistics
+import time
+
+
+def read_stats(host, port):
+    conn = http.client.HTTPConnection(host, port, timeout=5)
+    conn.request("GET", "/stats")
+    body = conn.getresponse().read().decode()
+    conn.close()
+    stats = {}
+    for line in body.splitlines():
+        key, _, value = line.partition(":")
+        if value.strip():
+            stats[key.strip()] = value.strip()
+    return stats
+
+
+def load_page(host, port, encoding):
+    start = time.monotonic()
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    conn.request("GET", "/", headers={"Accept-Encoding": encoding})
+    response = conn.getresponse()
+    size = len(response.read())
+    conn.close()
+    return (time.monotonic() - start) * 1000, size
+
+
+def run(host, port, encoding, loads):
+    times, stalls = [], []
+    size = 0
+    for _ in range(loads):
+        ms, size = load_page(host, port, encoding)
+        times.append(ms)
+        stalls.append(int(read_stats(host, port).get("pageLoadFrameGapUs", 0)) / 1000)
+        time.sleep(0.2)
+    return size, times, stalls
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--loads", type=int, default=20)
+    args = parser.parse_args()
+
+    print("%-8s %8s %10s %10s %12s %12s" % ("page", "bytes", "load p50", "load max",
+                                           "stall p50", "stall max"))
+    for name, encoding in (("plain", "identity"), ("gzip", "gzip")):
+        size, times, stalls = run(args.host, args.port, encoding, args.loads)
+        print("%-8s %8d %8.1fms %8.1fms %10.1fms %10.1fms" % (
+            name, size, statistics.median(times), max(times),
+            statistics.median(stalls), max(stalls)))
+
+
+if __name__ == "__main__":
+    main()
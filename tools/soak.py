@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Soak the lamp's web server and watch its heap for leaks and fragmentation.
+
+    python3 tools/soak.py                           # 100000 requests to 192.168.4.1
+    python3 tools/soak.py --requests 20000 --poll 500 --host 192.168.1.42
+
+Cycles through the control and read-only endpoints with valid and invalid
+parameters. Every --poll requests it reads heapFree, heapMaxBlock,
+heapFragmentation and heapMinFree from /stats. At the end it compares the
+last reading with the first one and exits 1 when free heap dropped or
+fragmentation grew by more than the limits given.
+"""
+import argparse
+import http.client
+import itertools
+import sys
+import time
+
+HEAP_KEYS = ("heapFree", "heapMaxBlock", "heapFragmentation", "heapMinFree")
+
+# Each is fetched in turn - replies of all sizes, errors and the 404 page
+REQUESTS = [
+    "/color?hex=FF8800",
+    "/brightness?val=180",
+    "/effect?id=12",
+    "/density?val=60",
+    "/music?effect=2",
+    "/state",
+    "/preset",
+    "/playlist",
+    "/schedule",
+    "/touch",
+    "/wifi",
+    "/timeline",
+    "/sync",
+    "/audio",
+    "/color",                 # Missing parameter
+    "/effect?id=abc",
+    "/no/such/page?x=1&y=2",  # Not found page echoes the parameters
+    "/brightness?val=220",
+    "/color?hex=2040FF",
+]
+
+
+def get(host, port, path):
+    conn = http.client.HTTPConnection(host, port, timeout=5)
+    try:
+        conn.request("GET", path)
+        response = conn.getresponse()
+        body = response.read()
+        return response.status, body
+    finally:
+        conn.close()
+
+
+def read_heap(host, port):
+    status, body = get(host, port, "/stats")
+    heap = {}
+    for line in body.decode(errors="replace").splitlines():
+        key, _, value = line.partition(":")
+        if key.strip() in HEAP_KEYS:
+            heap[key.strip()] = int(value)
+    return heap
+
+
+def show(done, heap, errors):
+    print("%8d  %8d  %8d  %5d%%  %8d  %6d" % (
+        done, heap.get("heapFree", 0), heap.get("heapMaxBlock", 0),
+        heap.get("heapFragmentation", 0), heap.get("heapMinFree", 0), errors))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--requests", type=int, default=100000)
+    parser.add_argument("--poll", type=int, default=1000, help="requests between heap readings")
+    parser.add_argument("--max-heap-drop", type=int, default=1024, help="bytes of free heap that may be lost")
+    parser.add_argument("--max-fragmentation-growth", type=int, default=10, help="percent points")
+    args = parser.parse_args()
+
+    print("requests   heapFree  maxBlock  frag.   minFree  errors")
+    first = read_heap(args.host, args.port)
+    show(0, first, 0)
+    last = first
+    errors = 0
+    started = time.monotonic()
+
+    paths = itertools.cycle(REQUESTS)
+    for done in range(1, args.requests + 1):
+        try:
+            status, _ = get(args.host, args.port, next(paths))
+            if status >= 500:
+                errors += 1
+        except (OSError, http.client.HTTPException):
+            errors += 1
+            time.sleep(0.5)  # Give a rebooting or overloaded lamp a moment
+        if done % args.poll == 0 or done == args.requests:
+            try:
+                last = read_heap(args.host, args.port)
+            except (OSError, http.client.HTTPException):
+                errors += 1
+                continue
+            show(done, last, errors)
+
+    elapsed = time.monotonic() - started
+    drop = first.get("heapFree", 0) - last.get("heapFree", 0)
+    growth = last.get("heapFragmentation", 0) - first.get("heapFragmentation", 0)
+    print("%d requests in %.0f s (%.0f/s), %d errors" % (
+        args.requests, elapsed, args.requests / max(elapsed, 0.001), errors))
+    print("heap free changed by %+d bytes, fragmentation by %+d points, lowest free %d" % (
+        -drop, growth, last.get("heapMinFree", 0)))
+
+    if drop > args.max_heap_drop or growth > args.max_fragmentation_growth:
+        print("FAIL: heap did not stay flat")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
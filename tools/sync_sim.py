@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Simulate a leader and followers running the MULTI-LAMP SYNC section on a PC.
+
+    python3 tools/sync_sim.py                       # 3 followers, 60 s, slack of 2 steps
+    python3 tools/sync_sim.py --slack 0             # adopt the leader's counters on every beacon
+    python3 tools/sync_sim.py --followers 5 --loss 20 --drift 40
+
+Every lamp has its own crystal error and an irregular loop() (a few ms per
+pass, now and then a long stall). The leader multicasts a beacon every
+SYNC_BEACON_INTERVAL ms, which reaches each follower after a random WiFi
+delay or not at all. Followers steer their copy of the leader's clock like
+receiveSyncBeacon() and run a rainbow-style effect stepped by
+effectStepDue(20), like the firmware effects: one step per 21 ms slot of
+the shared clock, with steps lost to a short stall caught up afterwards.
+A follower takes over the leader's counters when they are further off
+than --slack steps (0 = whenever they differ, close to the old behaviour
+of taking them from every beacon).
+
+Reported per follower: the clock error, how many steps its counter is off
+from the leader's at the same instant, and the jumps - loop passes where
+the counter moved by anything but 0 or +1 steps, which show as flicker.
+"""
+import argparse
+import heapq
+import random
+
+SYNC_BEACON_INTERVAL = 250_000   # us
+SYNC_PHASE_GAIN = 0.25
+SYNC_DRIFT_GAIN = 0.05
+SYNC_COUNTER_SLACK = 2
+EFFECT_INTERVAL = 20             # ms, as in effect1()
+EFFECT_STEPS = 256               # Counter wraps here
+EFFECT_CATCH_UP_STEPS = 8        # As in the firmware
+
+
+def wrapped(diff):
+    # Counter difference in steps, -128..127
+    return (diff + EFFECT_STEPS // 2) % EFFECT_STEPS - EFFECT_STEPS // 2
+
+
+class Lamp:
+    def __init__(self, ppm, rng):
+        self.rate = 1 + ppm * 1e-6
+        self.boot = rng.uniform(0, 5e6)     # Local clock reading at simulation start
+        self.rng = rng
+        self.counter = 0
+        self.last_update = 0
+        # Follower clock model
+        self.locked = False
+        self.offset = 0.0
+        self.anchor = 0.0
+        self.drift = 0.0
+        self.adoptions = 0
+        self.jumps = 0
+
+    def local(self, t):
+        return self.boot + t * self.rate
+
+    def shared(self, t):
+        now = self.local(t)
+        if not self.locked:
+            return now
+        return now + self.offset + self.drift * (now - self.anchor)
+
+    def next_loop(self, t, stall_chance):
+        if self.rng.random() < stall_chance:
+            return t + self.rng.uniform(20_000, 60_000)  # Flash write, page load...
+        return t + self.rng.uniform(1_500, 6_000)
+
+    def step_effect(self, t):
+        # effectStepDue(): one step per slot of the shared clock, steps a
+        # short stall skipped are caught up one per loop pass
+        period = EFFECT_INTERVAL + 1
+        now_ms = int(self.shared(t) // 1000)
+        if now_ms - self.last_update < period:
+            return
+        slot = now_ms - now_ms % period
+        if self.last_update % period == 0 and slot - self.last_update <= period * EFFECT_CATCH_UP_STEPS:
+            self.last_update += period
+        else:
+            self.last_update = slot
+        self.counter = (self.counter + 1) % EFFECT_STEPS
+
+    def receive(self, t, beacon, slack):
+        leader_micros, counter, last_update = beacon
+        now = self.local(t)
+        if not self.locked:
+            self.offset = leader_micros - now
+            self.anchor = now
+            self.drift = 0.0
+            self.locked = True
+            adopt = True
+        else:
+            estimate = self.shared(t)
+            error = leader_micros - estimate
+            elapsed = now - self.anchor
+            self.offset = (estimate - now) + error * SYNC_PHASE_GAIN
+            if elapsed > 0:
+                self.drift += SYNC_DRIFT_GAIN * error / elapsed
+            self.anchor = now
+            adopt = abs(wrapped(counter - self.counter)) > slack
+        if adopt:
+            self.counter = counter
+            self.last_update = last_update
+            self.adoptions += 1
+
+
+def percentile(values, percent):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * percent / 100))] if ordered else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--followers", type=int, default=3)
+    parser.add_argument("--seconds", type=float, default=60)
+    parser.add_argument("--slack", type=int, default=SYNC_COUNTER_SLACK, help="steps a follower may be off before adopting")
+    parser.add_argument("--drift", type=float, default=20, help="crystal error range, +-ppm")
+    parser.add_argument("--delay", type=float, default=3, help="mean WiFi delay of a beacon, ms")
+    parser.add_argument("--loss", type=float, default=5, help="percent of beacons lost")
+    parser.add_argument("--stalls", type=float, default=1, help="percent of loop passes that stall")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    leader = Lamp(rng.uniform(-args.drift, args.drift), rng)
+    followers = [Lamp(rng.uniform(-args.drift, args.drift), rng) for _ in range(args.followers)]
+    stall_chance = args.stalls / 100
+    end = args.seconds * 1e6
+
+    # Events: (true time us, order, kind, lamp index, payload)
+    events = [(0.0, 0, "loop", -1, None)]
+    events += [(rng.uniform(0, 5_000), i + 1, "loop", i, None) for i in range(len(followers))]
+    heapq.heapify(events)
+    order = len(events)
+    last_beacon = -SYNC_BEACON_INTERVAL
+    inbox = [[] for _ in followers]
+    previous = [0] * len(followers)
+    offsets = [[] for _ in followers]
+    clock_errors = [[] for _ in followers]
+    next_sample = 0.0
+
+    while events:
+        t, _, kind, index, payload = heapq.heappop(events)
+        if t > end:
+            break
+
+        # Sample every ms of true time between events
+        while next_sample <= t:
+            for i, follower in enumerate(followers):
+                if follower.locked:
+                    offsets[i].append(abs(wrapped(leader.counter - follower.counter)))
+                    clock_errors[i].append(abs(leader.shared(next_sample) - follower.shared(next_sample)))
+            next_sample += 1000
+
+        if kind == "beacon":
+            inbox[index].append(payload)
+            continue
+
+        if index < 0:
+            leader.step_effect(t)
+            if leader.local(t) - last_beacon >= SYNC_BEACON_INTERVAL:
+                last_beacon = leader.local(t)
+                beacon = (leader.shared(t), leader.counter, leader.last_update)
+                for i in range(len(followers)):
+                    if rng.random() * 100 >= args.loss:
+                        arrival = t + rng.expovariate(1 / (args.delay * 1000))
+                        heapq.heappush(events, (arrival, order, "beacon", i, beacon))
+                        order += 1
+            heapq.heappush(events, (leader.next_loop(t, stall_chance), order, "loop", -1, None))
+        else:
+            follower = followers[index]
+            for beacon in inbox[index]:
+                follower.receive(t, beacon, args.slack)
+            inbox[index] = []
+            follower.step_effect(t)
+            moved = wrapped(follower.counter - previous[index])
+            if moved not in (0, 1):
+                follower.jumps += 1
+            previous[index] = follower.counter
+            heapq.heappush(events, (follower.next_loop(t, stall_chance), order, "loop", index, None))
+        order += 1
+
+    minutes = args.seconds / 60
+    print("slack %d steps, %d followers, %.0f s" % (args.slack, len(followers), args.seconds))
+    print("follower  clock p50/p99 us  steps off p50/p99  adoptions/min  jumps/min")
+    for i, follower in enumerate(followers):
+        print("%8d  %7.0f / %-7.0f  %8d / %-6d  %13.1f  %9.1f" % (
+            i + 1, percentile(clock_errors[i], 50), percentile(clock_errors[i], 99),
+            percentile(offsets[i], 50), percentile(offsets[i], 99),
+            follower.adoptions / minutes, follower.jumps / minutes))
+
+
+if __name__ == "__main__":
+    main()